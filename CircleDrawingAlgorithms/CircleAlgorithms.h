@@ -0,0 +1,341 @@
+#ifndef CIRCLEDRAWINGALGORITHMS_CIRCLEALGORITHMS_H
+#define CIRCLEDRAWINGALGORITHMS_CIRCLEALGORITHMS_H
+
+#include <windows.h>
+#include <math.h>
+#include <vector>
+
+/*
+ * The circle algorithms are templates over the drawing surface so the same code can plot
+ * into a window (HDC) through GDI or into a headless buffer (see Framebuffer.h) that
+ * provides its own SetPixel(surface, x, y, color) overload.
+ */
+
+/*
+* struct Vertex
+* Description: one point of a circle outline generated as a vertex list instead of pixels
+* x: x coordinate
+* y: y coordinate
+*/
+struct Vertex {
+    float x,y;
+};
+
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+
+/* Round double
+ * Description: function attempts to round a double precision floating-point number to the nearest integer
+ *              by adding 0.5 to the input number and returning the result.
+ */
+inline int Round( double num);
+
+/* 8 symmetry points
+ * Description: When this function is give one point on the circle it can calculate
+ *				7 more points on the circle and draw them, So, by using this function we
+ *				will need to give it only one octet of the circle and the function will draw the
+ *				whole circle.
+ */
+template <typename Surface>
+void draw8points(Surface &hdc,int xc,int yc,int x, int y,COLORREF color);
+
+/* Direct Circle Algorithm from second octant
+ * Description: The Direct algorithm to draw circle, using the second octet where the |slope| <= 1
+ * Increases x by 1 then calculate the y value, then draw the 8 points calculated from the
+ *				point we've got.
+ */
+template <typename Surface>
+void DrawCircle(Surface &hdc ,int xc,int yc,int r,COLORREF color);
+
+/* Polar Circle Algorithm from first octant
+ * Description: The second algorithm to draw circle (Polar Algorithm) using only r and theta
+ *			    this algorithm draws only the first octet by incrementing the angle (theta) then
+ *				calculating x and y then draw the 8 points calculated from the point we've got.
+ */
+template <typename Surface>
+void DrawCirclePolarAlgorithm(Surface &hdc ,int xc,int yc,int r,COLORREF color);
+
+/* Iterative Polar Circle Algorithm from first octant
+ * Description: using the same concept in the polar algorithm but this one is Iterative Polar, by calculating the difference between the points
+ *				and add them to the point we have each iteration to get the new point, then draw the 8 points calculated
+ *				from the new point we've got.
+ */
+template <typename Surface>
+void DrawCircleIterativePolarAlgorithm(Surface &hdc ,int xc,int yc,int r,COLORREF color);
+
+template <typename Surface>
+void DrawCircleBresenham1Algorithm(Surface &hdc ,int xc,int yc,int r,COLORREF color);
+
+template <typename Surface>
+void DrawCircleBresenham2Algorithm(Surface &hdc ,int xc,int yc,int r,COLORREF color);
+
+/* Iterative Polar Circle Algorithm in single precision
+ * Description: same as DrawCircleIterativePolarAlgorithm but the point and the rotation (cos, sin of d_theta)
+ *				are kept in float, halving the register/memory width of the rotation.
+ */
+template <typename Surface>
+void DrawCircleIterativePolarFloatAlgorithm(Surface &hdc ,int xc,int yc,int r,COLORREF color);
+
+/* Iterative Polar Circle Algorithm in fixed point
+ * Description: same rotation done with integers only, the point is kept in Q16 (16 fraction bits) and cos/sin
+ *				of d_theta in Q30 so the rotation itself does not make the radius grow or shrink noticeably,
+ *				rounding to a pixel is an add and a shift instead of a double to int conversion.
+ */
+template <typename Surface>
+void DrawCircleIterativePolarFixedAlgorithm(Surface &hdc ,int xc,int yc,int r,COLORREF color);
+
+/* Circle vertices by iterative polar rotation
+ * Description: generates n vertices around the whole circle (not only one octant) by rotating the previous
+ *				vertex by d_theta=2*pi/n in float, the vertices are appended to out.
+ */
+inline void CircleVerticesIterativePolar(float xc,float yc,float r,int n,std::vector<Vertex> &out);
+
+/* Circle vertices by blocked iterative polar rotation
+ * Description: vectorized form of CircleVerticesIterativePolar, keeps CIRCLE_LANES consecutive vertices
+ *				(seeded with cos/sin of k*d_theta, k=0..CIRCLE_LANES-1) and rotates all of them by
+ *				CIRCLE_LANES*d_theta at once, the lanes are independent so the inner loops compile to SIMD
+ *				and every lane goes through n/CIRCLE_LANES rotations instead of n, so it also drifts less.
+ *				The lanes are re-seeded with cos/sin every CIRCLE_RESEED blocks to keep the float error bounded.
+ */
+inline void CircleVerticesIterativePolarBlocked(float xc,float yc,float r,int n,std::vector<Vertex> &out);
+
+/*****************************************************************************
+*							Functions Implementation
+******************************************************************************/
+
+/* Round double
+ * Description: function attempts to round a double precision floating-point number to the nearest integer
+ *              by adding 0.5 to the input number and returning the result.
+ */
+inline int Round( double num){
+    return num+0.5;
+}
+
+/* 8 symmetry points
+ * Description: When this function is give one point on the circle it can calculate
+ *				7 more points on the circle and draw them, So, by using this function we
+ *				will need to give it only one octet of the circle and the function will draw the
+ *				whole circle.
+ */
+template <typename Surface>
+void draw8points(Surface &hdc,int xc,int yc,int x, int y,COLORREF color){
+    SetPixel(hdc,xc+x,yc+y,color);
+    SetPixel(hdc,xc-x,yc+y,color);
+    SetPixel(hdc,xc-x,yc-y,color);
+    SetPixel(hdc,xc+x,yc-y,color);
+    SetPixel(hdc,xc+y,yc+x,color);
+    SetPixel(hdc,xc-y,yc+x,color);
+    SetPixel(hdc,xc+y,yc-x,color);
+    SetPixel(hdc,xc-y,yc-x,color);
+}
+
+/* Direct Circle Algorithm from second octant
+ * Description: The Direct algorithm to draw circle, using the second octet where the |slope| <= 1
+ *				Increases x by 1 then calculate the y value, then draw the 8 points calculated from the
+ *				point we've got.
+ */
+template <typename Surface>
+void DrawCircle(Surface &hdc ,int xc,int yc,int r,COLORREF color){
+    int x=0;
+    int y=r;
+    draw8points(hdc,xc,yc,x,y,color);
+    while (x < y) {
+        x++;
+        y=Round(sqrt((r*r)-(x*x)));
+        draw8points(hdc,xc,yc,x,y,color);
+    }
+}
+
+/* Polar Circle Algorithm from first octant
+ * Description: The second algorithm to draw circle (Polar Algorithm) using only r and theta
+ *				this algorithm draws only the first octet by incrementing the angle (theta) then
+ *				calculating x and y then draw the 8 points calculated from the point we've got.
+ */
+template <typename Surface>
+void DrawCirclePolarAlgorithm(Surface &hdc ,int xc,int yc,int r,COLORREF color){
+    int x=r , y=0;
+    double theta=0,d_theta=1.0/r;
+    draw8points(hdc,xc,yc,x,y,color);
+    while (x > y) {
+        theta+=d_theta;
+        x=Round(r* cos(theta));
+        y=Round(r* sin(theta));
+        draw8points(hdc,xc,yc,x,y,color);
+    }
+}
+/* Iterative Polar Circle Algorithm from first octant
+ * Description: using the same concept in the polar algorithm but this one is Iterative Polar, by calculating the difference between the points
+ *				and add them to the point we have each iteration to get the new point, then draw the 8 points calculated
+ *				from the new point we've got.
+ */
+template <typename Surface>
+void DrawCircleIterativePolarAlgorithm(Surface &hdc ,int xc,int yc,int r,COLORREF color){
+    double x=r , y=0;
+    double d_theta=1.0/r;
+
+    double c= cos(d_theta),s= sin(d_theta);
+    while (x > y) {
+        double temp=(x*c)-(y*s);
+        y = (x * s) + (y * c);
+        x = temp;
+        draw8points(hdc,xc,yc, Round(x),Round(y),color);
+    }
+}
+/* Bresenham Algorithm1 for circle
+ * Description:
+ * This code implements the Bresenham's Algorithm for drawing a circle efficiently on a 2D grid.
+ * The algorithm avoids the need for expensive trigonometric calculations by using integer arithmetic and taking advantage of the symmetry properties of circles.
+ * It starts from the topmost point of the circle and iteratively calculates the positions of points in 8 octants, incrementally drawing the circle.
+ * The decision parameter is updated based on the distance of the current point from the ideal circle, determining whether to move horizontally or diagonally.
+ * This approach minimizes computational overhead and produces accurate circle approximatio
+ * */
+template <typename Surface>
+void DrawCircleBresenham1Algorithm(Surface &hdc ,int xc,int yc,int r,COLORREF color){
+    int x=0 , y=r;
+    draw8points(hdc,xc,yc, Round(x),Round(y),color);
+    int d=1-r;
+    while (x<y){
+        int d_ch1=(2*x)+3;
+        int d_ch2=2*(x-y)+5;
+        if (d<0){
+            d+=d_ch1;
+        }else{
+            y--;
+            d+=d_ch2;
+        }
+        x++;
+        draw8points(hdc,xc,yc, Round(x),Round(y),color);
+    }
+
+}
+/* Bresenham Algorithm1 for circle
+ * Description:
+ * This code implements a variation of Bresenham's Algorithm for drawing a circle efficiently on a 2D grid.
+ * Compared to the original algorithm, this version optimizes the calculation of decision parameters to further reduce computational overhead.
+ * It starts from the topmost point of the circle and iteratively calculates the positions of points in 8 octants, incrementally drawing the circle.
+ * The decision parameter is updated based on the distance of the current point from the ideal circle, determining whether to move horizontally or diagonally.
+ * This approach minimizes computational overhead and produces accurate circle approximations.
+ * */
+template <typename Surface>
+void DrawCircleBresenham2Algorithm(Surface &hdc ,int xc,int yc,int r,COLORREF color){
+    int x=0 , y=r;
+    draw8points(hdc,xc,yc, Round(x),Round(y),color);
+    int d=1-r;
+    int d_ch1=3;
+    int d_ch2=5-(2*r);
+    while (x<y){
+        if (d<0){
+            d+=d_ch1;
+            d_ch2+=2;
+        }else{
+            d+=d_ch2;
+            d_ch2+=4;
+            y--;
+        }
+        x++;
+        d_ch1+=2;
+        draw8points(hdc,xc,yc, Round(x),Round(y),color);
+    }
+}
+
+/* Iterative Polar Circle Algorithm in single precision
+ * Description: same as DrawCircleIterativePolarAlgorithm but the point and the rotation (cos, sin of d_theta)
+ *				are kept in float, halving the register/memory width of the rotation.
+ */
+template <typename Surface>
+void DrawCircleIterativePolarFloatAlgorithm(Surface &hdc ,int xc,int yc,int r,COLORREF color){
+    float x=(float)r , y=0;
+    float d_theta=1.0f/r;
+
+    float c= cosf(d_theta),s= sinf(d_theta);
+    while (x > y) {
+        float temp=(x*c)-(y*s);
+        y = (x * s) + (y * c);
+        x = temp;
+        draw8points(hdc,xc,yc, (int)(x+0.5f),(int)(y+0.5f),color);
+    }
+}
+
+/* Iterative Polar Circle Algorithm in fixed point
+ * Description: same rotation done with integers only, the point is kept in Q16 (16 fraction bits) and cos/sin
+ *				of d_theta in Q30 so the rotation itself does not make the radius grow or shrink noticeably,
+ *				rounding to a pixel is an add and a shift instead of a double to int conversion.
+ */
+template <typename Surface>
+void DrawCircleIterativePolarFixedAlgorithm(Surface &hdc ,int xc,int yc,int r,COLORREF color){
+    const long long ONE=1LL<<16 , HALF=1LL<<15;
+    const long long ROT_ONE=1LL<<30 , ROT_HALF=1LL<<29;
+    long long x=r*ONE , y=0;
+    double d_theta=1.0/r;
+
+    long long c=(long long)(cos(d_theta)*ROT_ONE+0.5) , s=(long long)(sin(d_theta)*ROT_ONE+0.5);
+    while (x > y) {
+        long long temp=((x*c)-(y*s)+ROT_HALF)>>30;
+        y = ((x * s) + (y * c)+ROT_HALF)>>30;
+        x = temp;
+        draw8points(hdc,xc,yc, (int)((x+HALF)>>16),(int)((y+HALF)>>16),color);
+    }
+}
+
+/* Circle vertices by iterative polar rotation
+ * Description: generates n vertices around the whole circle (not only one octant) by rotating the previous
+ *				vertex by d_theta=2*pi/n in float, the vertices are appended to out.
+ */
+inline void CircleVerticesIterativePolar(float xc,float yc,float r,int n,std::vector<Vertex> &out){
+    if (n<=0)return;
+    double d_theta=2*3.14159265358979323846/n;
+    float c=(float)cos(d_theta),s=(float)sin(d_theta);
+    float x=r , y=0;
+    out.reserve(out.size()+n);
+    for (int i=0;i<n;i++){
+        out.push_back(Vertex{xc+x,yc+y});
+        float temp=(x*c)-(y*s);
+        y = (x * s) + (y * c);
+        x = temp;
+    }
+}
+
+/* Circle vertices by blocked iterative polar rotation
+ * Description: vectorized form of CircleVerticesIterativePolar, keeps CIRCLE_LANES consecutive vertices
+ *				(seeded with cos/sin of k*d_theta, k=0..CIRCLE_LANES-1) and rotates all of them by
+ *				CIRCLE_LANES*d_theta at once, the lanes are independent so the inner loops compile to SIMD
+ *				and every lane goes through n/CIRCLE_LANES rotations instead of n, so it also drifts less.
+ *				The lanes are re-seeded with cos/sin every CIRCLE_RESEED blocks to keep the float error bounded.
+ */
+inline void CircleVerticesIterativePolarBlocked(float xc,float yc,float r,int n,std::vector<Vertex> &out){
+    const int CIRCLE_LANES=8 , CIRCLE_RESEED=256;
+    if (n<=0)return;
+    double d_theta=2*3.14159265358979323846/n;
+    float X[CIRCLE_LANES],Y[CIRCLE_LANES];
+    float c=(float)cos(CIRCLE_LANES*d_theta),s=(float)sin(CIRCLE_LANES*d_theta);
+
+    size_t base=out.size();
+    out.resize(base+n);
+    Vertex *v=&out[base];
+    for (int i=0;i<n;){
+        // re-seed the lanes from the exact angle so float drift stays bounded on long lists
+        for (int k=0;k<CIRCLE_LANES;k++){
+            X[k]=(float)(r*cos((i+k)*d_theta));
+            Y[k]=(float)(r*sin((i+k)*d_theta));
+        }
+        int end=i+CIRCLE_LANES*CIRCLE_RESEED<n ? i+CIRCLE_LANES*CIRCLE_RESEED : n;
+        for (;i+CIRCLE_LANES<=end;i+=CIRCLE_LANES){
+            for (int k=0;k<CIRCLE_LANES;k++){
+                v[i+k].x=xc+X[k];
+                v[i+k].y=yc+Y[k];
+            }
+            for (int k=0;k<CIRCLE_LANES;k++){
+                float temp=(X[k]*c)-(Y[k]*s);
+                Y[k]=(X[k]*s)+(Y[k]*c);
+                X[k]=temp;
+            }
+        }
+        for (int k=0;i<end;i++,k++){
+            v[i].x=xc+X[k];
+            v[i].y=yc+Y[k];
+        }
+    }
+}
+
+#endif //CIRCLEDRAWINGALGORITHMS_CIRCLEALGORITHMS_H
@@ -0,0 +1,55 @@
+#ifndef CIRCLEDRAWINGALGORITHMS_FRAMEBUFFER_H
+#define CIRCLEDRAWINGALGORITHMS_FRAMEBUFFER_H
+
+#include <windows.h>
+#include <vector>
+
+/*
+* struct Framebuffer
+* Description: Headless drawing surface kept in memory, one COLORREF per pixel stored row by row.
+*              It can be passed to the circle algorithms in place of an HDC.
+* width: number of columns
+* height: number of rows
+* pixels: width*height colors, pixel (x,y) is at pixels[y*width+x]
+*/
+struct Framebuffer {
+    int width,height;
+    std::vector<COLORREF> pixels;
+    Framebuffer(int width = 0, int height = 0, COLORREF background = RGB(255, 255, 255))
+        : width(width), height(height), pixels((size_t)width * height, background) {}
+};
+
+/*
+* Clear
+* Description: Set every pixel of the framebuffer to the given color
+* parameter: Framebuffer fb, COLORREF color
+*/
+inline void Clear(Framebuffer &fb, COLORREF color){
+    fb.pixels.assign(fb.pixels.size(), color);
+}
+
+/*
+* SetPixel
+* Description: Same contract as the GDI SetPixel: pixels outside the buffer are ignored
+*              and CLR_INVALID is returned for them
+* parameter: Framebuffer fb, int x, int y, COLORREF color
+*/
+inline COLORREF SetPixel(Framebuffer &fb, int x, int y, COLORREF color){
+    if ((unsigned)x >= (unsigned)fb.width || (unsigned)y >= (unsigned)fb.height)
+        return CLR_INVALID;
+    fb.pixels[(size_t)y * fb.width + x] = color;
+    return color;
+}
+
+/*
+* GetPixel
+* Description: Same contract as the GDI GetPixel, CLR_INVALID outside the buffer
+* parameter: Framebuffer fb, int x, int y
+*/
+inline COLORREF GetPixel(const Framebuffer &fb, int x, int y){
+    if ((unsigned)x >= (unsigned)fb.width || (unsigned)y >= (unsigned)fb.height)
+        return CLR_INVALID;
+    return fb.pixels[(size_t)y * fb.width + x];
+}
+
+#endif //CIRCLEDRAWINGALGORITHMS_FRAMEBUFFER_H
@@ -0,0 +1,285 @@
+#include <windows.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "CircleAlgorithms.h"
+#include "Framebuffer.h"
+
+/*
+ * Circle algorithms benchmark
+ * Description: Times every circle algorithm into a headless Framebuffer and reports ns/pixel,
+ *              then compares the pixel set of every algorithm against an exact reference circle
+ *              (nearest pixel to the true circle in every column of the second octant) for every
+ *              radius from 1 to the maximum radius.
+ *              Finally times the circle vertex list generators against direct cos/sin evaluation.
+ * usage: CircleDrawingAlgorithmsBenchmark [maxRadius]   (default 4096)
+ */
+
+/*
+* struct PixelRecorder
+* Description: Surface that records the plotted pixels relative to the circle center instead of
+*              drawing them, so the pixel sets of two algorithms can be compared
+* keys: packed (x,y) of every SetPixel call, sorted and made unique by Record
+* calls: number of SetPixel calls, duplicates included
+*/
+struct PixelRecorder {
+    int xc,yc;
+    std::vector<long long> keys;
+    long long calls;
+};
+
+inline COLORREF SetPixel(PixelRecorder &rec, int x, int y, COLORREF color){
+    rec.keys.push_back((long long)(x - rec.xc) * (1LL << 32) + (unsigned)(y - rec.yc));
+    rec.calls++;
+    return color;
+}
+
+/*
+* struct Algorithm
+* Description: One circle algorithm instantiated for both surfaces
+*/
+struct Algorithm {
+    const char *name;
+    void (*draw)(Framebuffer &, int, int, int, COLORREF);
+    void (*record)(PixelRecorder &, int, int, int, COLORREF);
+};
+
+/*
+* struct Accuracy
+* Description: Result of comparing an algorithm's pixels with the reference for one radius
+* missing: reference pixels the algorithm did not plot
+* extra: plotted pixels that are not in the reference
+* maxError: largest |distance(pixel, center) - r| among the plotted pixels
+*/
+struct Accuracy {
+    long long calls,missing,extra;
+    double maxError;
+};
+
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+
+/*
+* DrawExactCircle
+* Description: Reference circle, for every column x of the second octant (2x^2 <= r^2) plots the
+*              pixel nearest to the true circle y = sqrt(r^2 - x^2) and its 7 symmetric points
+* parameter: PixelRecorder rec, int xc, int yc, int r, COLORREF color
+*/
+void DrawExactCircle(PixelRecorder &rec, int xc, int yc, int r, COLORREF color);
+/*
+* Record
+* Description: Run an algorithm into a recorder and sort/unique the recorded pixels
+* parameter: recorder function, int r
+*/
+PixelRecorder Record(void (*record)(PixelRecorder &, int, int, int, COLORREF), int r);
+/*
+* Compare
+* Description: Count missing/extra pixels of rec against ref and measure the max radial error of rec
+* parameter: PixelRecorder rec, PixelRecorder ref, int r
+*/
+Accuracy Compare(const PixelRecorder &rec, const PixelRecorder &ref, int r);
+/*
+* TimeAlgorithm
+* Description: Draw the circle repeatedly into the framebuffer and return the average ns per plotted pixel
+* parameter: Algorithm algorithm, Framebuffer fb, int r, long long pixelsPerCircle
+*/
+double TimeAlgorithm(const Algorithm &algorithm, Framebuffer &fb, int r, long long pixelsPerCircle);
+/*
+* CircleVerticesDirect
+* Description: Reference vertex list, evaluates cos/sin in double for every vertex
+* parameter: float xc, float yc, float r, int n, vector out
+*/
+void CircleVerticesDirect(float xc, float yc, float r, int n, std::vector<Vertex> &out);
+/*
+* BenchmarkVertices
+* Description: Time a vertex generator for n vertices and print ns/vertex and its max radial error
+* parameter: name, generator function, float r, int n
+*/
+void BenchmarkVertices(const char *name, void (*generate)(float, float, float, int, std::vector<Vertex> &), float r, int n);
+
+int main(int argc, char **argv)
+{
+    int maxRadius = argc > 1 ? atoi(argv[1]) : 4096;
+    if (maxRadius < 1)
+        maxRadius = 1;
+
+    const Algorithm algorithms[] = {
+            {"Direct",          &DrawCircle<Framebuffer>,                        &DrawCircle<PixelRecorder>},
+            {"Polar",           &DrawCirclePolarAlgorithm<Framebuffer>,          &DrawCirclePolarAlgorithm<PixelRecorder>},
+            {"IterativePolar",  &DrawCircleIterativePolarAlgorithm<Framebuffer>, &DrawCircleIterativePolarAlgorithm<PixelRecorder>},
+            {"Bresenham1",      &DrawCircleBresenham1Algorithm<Framebuffer>,     &DrawCircleBresenham1Algorithm<PixelRecorder>},
+            {"Bresenham2",      &DrawCircleBresenham2Algorithm<Framebuffer>,     &DrawCircleBresenham2Algorithm<PixelRecorder>},
+            {"IterPolarFloat",  &DrawCircleIterativePolarFloatAlgorithm<Framebuffer>, &DrawCircleIterativePolarFloatAlgorithm<PixelRecorder>},
+            {"IterPolarFixed",  &DrawCircleIterativePolarFixedAlgorithm<Framebuffer>, &DrawCircleIterativePolarFixedAlgorithm<PixelRecorder>},
+    };
+    const int count = sizeof(algorithms) / sizeof(algorithms[0]);
+
+    // timing and accuracy table for radii 1,2,3,4,6,8,12,16,... up to maxRadius
+    std::vector<int> sampled;
+    for (int p = 1; p <= maxRadius; p *= 2) {
+        sampled.push_back(p);
+        if (p > 1 && p + p / 2 <= maxRadius)
+            sampled.push_back(p + p / 2);
+    }
+    if (sampled.back() != maxRadius)
+        sampled.push_back(maxRadius);
+
+    printf("%7s  %-15s %9s %9s %10s %8s %8s\n", "radius", "algorithm", "pixels", "ns/pixel", "max error", "missing", "extra");
+    for (int r : sampled) {
+        PixelRecorder ref = Record(&DrawExactCircle, r);
+        Framebuffer fb(2 * r + 3, 2 * r + 3);
+        for (int a = 0; a < count; a++) {
+            PixelRecorder rec = Record(algorithms[a].record, r);
+            Accuracy acc = Compare(rec, ref, r);
+            double ns = TimeAlgorithm(algorithms[a], fb, r, acc.calls);
+            printf("%7d  %-15s %9lld %9.2f %10.4f %8lld %8lld\n", r, algorithms[a].name, acc.calls, ns, acc.maxError, acc.missing, acc.extra);
+        }
+    }
+
+    // drift scan over every radius: where does each algorithm stop matching the reference
+    printf("\nAccuracy over every radius 1..%d against the exact reference\n", maxRadius);
+    printf("%-15s %12s %14s %14s %10s %8s\n", "algorithm", "radii w/diff", "first diff r", "first err>1 r", "max error", "at r");
+    std::vector<int> differing(count, 0), firstDiff(count, 0), firstVisible(count, 0), worstRadius(count, 0);
+    std::vector<double> worst(count, 0.0);
+    for (int r = 1; r <= maxRadius; r++) {
+        PixelRecorder ref = Record(&DrawExactCircle, r);
+        for (int a = 0; a < count; a++) {
+            Accuracy acc = Compare(Record(algorithms[a].record, r), ref, r);
+            if (acc.missing || acc.extra) {
+                differing[a]++;
+                if (!firstDiff[a])
+                    firstDiff[a] = r;
+            }
+            if (acc.maxError > 1.0 && !firstVisible[a])
+                firstVisible[a] = r;
+            if (acc.maxError > worst[a]) {
+                worst[a] = acc.maxError;
+                worstRadius[a] = r;
+            }
+        }
+    }
+    for (int a = 0; a < count; a++)
+        printf("%-15s %12d %14d %14d %10.4f %8d\n", algorithms[a].name, differing[a], firstDiff[a], firstVisible[a], worst[a], worstRadius[a]);
+
+    printf("\nCircle vertex lists, r=%d\n", maxRadius);
+    printf("%9s  %-15s %10s %10s\n", "vertices", "generator", "ns/vertex", "max error");
+    for (int n = 64; n <= (1 << 20); n *= 16) {
+        BenchmarkVertices("Direct cos/sin", &CircleVerticesDirect, (float)maxRadius, n);
+        BenchmarkVertices("IterativePolar", &CircleVerticesIterativePolar, (float)maxRadius, n);
+        BenchmarkVertices("Blocked", &CircleVerticesIterativePolarBlocked, (float)maxRadius, n);
+    }
+    return 0;
+}
+
+/*
+* DrawExactCircle
+* Description: Reference circle, for every column x of the second octant (2x^2 <= r^2) plots the
+*              pixel nearest to the true circle y = sqrt(r^2 - x^2) and its 7 symmetric points
+* parameter: PixelRecorder rec, int xc, int yc, int r, COLORREF color
+*/
+void DrawExactCircle(PixelRecorder &rec, int xc, int yc, int r, COLORREF color){
+    long long rr = (long long)r * r;
+    for (long long x = 0; 2 * x * x <= rr; x++) {
+        int y = (int)std::lround(std::sqrt((double)(rr - x * x)));
+        draw8points(rec, xc, yc, (int)x, y, color);
+    }
+}
+
+/*
+* Record
+* Description: Run an algorithm into a recorder and sort/unique the recorded pixels
+* parameter: recorder function, int r
+*/
+PixelRecorder Record(void (*record)(PixelRecorder &, int, int, int, COLORREF), int r){
+    PixelRecorder rec;
+    rec.xc = rec.yc = r + 1;
+    rec.calls = 0;
+    record(rec, rec.xc, rec.yc, r, RGB(0, 0, 0));
+    std::sort(rec.keys.begin(), rec.keys.end());
+    rec.keys.erase(std::unique(rec.keys.begin(), rec.keys.end()), rec.keys.end());
+    return rec;
+}
+
+/*
+* Compare
+* Description: Count missing/extra pixels of rec against ref and measure the max radial error of rec
+* parameter: PixelRecorder rec, PixelRecorder ref, int r
+*/
+Accuracy Compare(const PixelRecorder &rec, const PixelRecorder &ref, int r){
+    Accuracy acc = {rec.calls, 0, 0, 0.0};
+    size_t i = 0, j = 0;
+    while (i < rec.keys.size() || j < ref.keys.size()) {
+        if (j == ref.keys.size() || (i < rec.keys.size() && rec.keys[i] < ref.keys[j])) {
+            acc.extra++;
+            i++;
+        } else if (i == rec.keys.size() || ref.keys[j] < rec.keys[i]) {
+            acc.missing++;
+            j++;
+        } else {
+            i++;
+            j++;
+        }
+    }
+    for (long long key : rec.keys) {
+        double x = (double)(int)(key >> 32), y = (double)(int)(unsigned)key;
+        double error = std::fabs(std::sqrt(x * x + y * y) - r);
+        if (error > acc.maxError)
+            acc.maxError = error;
+    }
+    return acc;
+}
+
+/*
+* TimeAlgorithm
+* Description: Draw the circle repeatedly into the framebuffer and return the average ns per plotted pixel
+* parameter: Algorithm algorithm, Framebuffer fb, int r, long long pixelsPerCircle
+*/
+double TimeAlgorithm(const Algorithm &algorithm, Framebuffer &fb, int r, long long pixelsPerCircle){
+    const long long targetPixels = 1 << 22;
+    long long repeats = std::max(1LL, targetPixels / std::max(1LL, pixelsPerCircle));
+    algorithm.draw(fb, r + 1, r + 1, r, RGB(0, 0, 0)); // warm up
+    auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < repeats; i++)
+        algorithm.draw(fb, r + 1, r + 1, r, RGB(0, 0, (BYTE)i));
+    auto stop = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+    return ns / ((double)repeats * std::max(1LL, pixelsPerCircle));
+}
+
+/*
+* CircleVerticesDirect
+* Description: Reference vertex list, evaluates cos/sin in double for every vertex
+* parameter: float xc, float yc, float r, int n, vector out
+*/
+void CircleVerticesDirect(float xc, float yc, float r, int n, std::vector<Vertex> &out){
+    double d_theta = 2 * 3.14159265358979323846 / n;
+    out.reserve(out.size() + n);
+    for (int i = 0; i < n; i++)
+        out.push_back(Vertex{(float)(xc + r * std::cos(i * d_theta)), (float)(yc + r * std::sin(i * d_theta))});
+}
+
+/*
+* BenchmarkVertices
+* Description: Time a vertex generator for n vertices and print ns/vertex and its max radial error
+* parameter: name, generator function, float r, int n
+*/
+void BenchmarkVertices(const char *name, void (*generate)(float, float, float, int, std::vector<Vertex> &), float r, int n){
+    std::vector<Vertex> out;
+    out.reserve(n);
+    long long repeats = std::max(1, (1 << 22) / n);
+    auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < repeats; i++) {
+        out.clear();
+        generate(0, 0, r, n, out);
+    }
+    auto stop = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(stop - start).count() / ((double)repeats * n);
+    double maxError = 0;
+    for (const Vertex &v : out)
+        maxError = std::max(maxError, std::fabs(std::sqrt((double)v.x * v.x + (double)v.y * v.y) - r));
+    printf("%9d  %-15s %10.3f %10.4f\n", n, name, ns, maxError);
+}
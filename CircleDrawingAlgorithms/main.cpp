@@ -7,6 +7,7 @@
 #include <tchar.h>
 #include <windows.h>
 #include <math.h>
+#include "CircleAlgorithms.h"
 
 /*  Declare Windows procedure  */
 LRESULT CALLBACK WindowProcedure (HWND, UINT, WPARAM, LPARAM);
@@ -15,44 +16,6 @@ LRESULT CALLBACK WindowProcedure (HWND, UINT, WPARAM, LPARAM);
 *							Functions Definitions
 ******************************************************************************/
 
-/* 8 symmetry points
- * Description: When this function is give one point on the circle it can calculate
- *				7 more points on the circle and draw them, So, by using this function we
- *				will need to give it only one octet of the circle and the function will draw the
- *				whole circle.
- */
-void draw8points(HDC hdc,int xc,int yc,int x, int y,COLORREF color);
-/* Direct Circle Algorithm from second octant
- * Description: The Direct algorithm to draw circle, using the second octet where the |slope| <= 1
- * Increases x by 1 then calculate the y value, then draw the 8 points calculated from the
- *				point we've got.
- */
-void DrawCircle(HDC hdc ,int xc,int yc,int r,COLORREF color);
-
-/* Polar Circle Algorithm from first octant
- * Description: The second algorithm to draw circle (Polar Algorithm) using only r and theta
- *			    this algorithm draws only the first octet by incrementing the angle (theta) then
- *				calculating x and y then draw the 8 points calculated from the point we've got.
- */
-void DrawCirclePolarAlgorithm(HDC hdc ,int xc,int yc,int r,COLORREF color);
-
-/* Iterative Polar Circle Algorithm from first octant
- * Description: using the same concept in the polar algorithm but this one is Iterative Polar, by calculating the difference between the points
- *				and add them to the point we have each iteration to get the new point, then draw the 8 points calculated
- *				from the new point we've got.
- */
-void DrawCircleIterativePolarAlgorithm(HDC hdc ,int xc,int yc,int r,COLORREF color);
-
-void DrawCircleBresenham1Algorithm(HDC hdc ,int xc,int yc,int r,COLORREF color);
-
-void DrawCircleBresenham2Algorithm(HDC hdc ,int xc,int yc,int r,COLORREF color);
-/* Round double
- * Description: function attempts to round a double precision floating-point number to the nearest integer
- *              by adding 0.5 to the input number and returning the result.
- */
-
-int Round( double num);
-
 void DrawSmileFace(HDC hdc ,int xc,int yc,int r,COLORREF color);
 
 /*  Make the class name into a global variable  */
@@ -156,135 +119,6 @@ LRESULT CALLBACK WindowProcedure (HWND hwnd, UINT message, WPARAM wParam, LPARAM
 *							Functions Implementation
 ******************************************************************************/
 
-/* Round double
- * Description: function attempts to round a double precision floating-point number to the nearest integer
- *              by adding 0.5 to the input number and returning the result.
- */
-int Round( double num){
-    return num+0.5;
-}
-
-/* 8 symmetry points
- * Description: When this function is give one point on the circle it can calculate
- *				7 more points on the circle and draw them, So, by using this function we
- *				will need to give it only one octet of the circle and the function will draw the
- *				whole circle.
- */
-void draw8points(HDC hdc,int xc,int yc,int x, int y,COLORREF color){
-    SetPixel(hdc,xc+x,yc+y,color);
-    SetPixel(hdc,xc-x,yc+y,color);
-    SetPixel(hdc,xc-x,yc-y,color);
-    SetPixel(hdc,xc+x,yc-y,color);
-    SetPixel(hdc,xc+y,yc+x,color);
-    SetPixel(hdc,xc-y,yc+x,color);
-    SetPixel(hdc,xc+y,yc-x,color);
-    SetPixel(hdc,xc-y,yc-x,color);
-}
-
-/* Direct Circle Algorithm from second octant
- * Description: The Direct algorithm to draw circle, using the second octet where the |slope| <= 1
- *				Increases x by 1 then calculate the y value, then draw the 8 points calculated from the
- *				point we've got.
- */
-void DrawCircle(HDC hdc ,int xc,int yc,int r,COLORREF color){
-    int x=0;
-    int y=r;
-    draw8points(hdc,xc,yc,x,y,color);
-    while (x < y) {
-        x++;
-        y=Round(sqrt((r*r)-(x*x)));
-        draw8points(hdc,xc,yc,x,y,color);
-    }
-}
-
-/* Polar Circle Algorithm from first octant
- * Description: The second algorithm to draw circle (Polar Algorithm) using only r and theta
- *				this algorithm draws only the first octet by incrementing the angle (theta) then
- *				calculating x and y then draw the 8 points calculated from the point we've got.
- */
-void DrawCirclePolarAlgorithm(HDC hdc ,int xc,int yc,int r,COLORREF color){
-    int x=r , y=0;
-    double theta=0,d_theta=1.0/r;
-    draw8points(hdc,xc,yc,x,y,color);
-    while (x > y) {
-        theta+=d_theta;
-        x=Round(r* cos(theta));
-        y=Round(r* sin(theta));
-        draw8points(hdc,xc,yc,x,y,color);
-    }
-}
-/* Iterative Polar Circle Algorithm from first octant
- * Description: using the same concept in the polar algorithm but this one is Iterative Polar, by calculating the difference between the points
- *				and add them to the point we have each iteration to get the new point, then draw the 8 points calculated
- *				from the new point we've got.
- */
-void DrawCircleIterativePolarAlgorithm(HDC hdc ,int xc,int yc,int r,COLORREF color){
-    double x=r , y=0;
-    double theta=0,d_theta=1.0/r;
-
-    double c= cos(d_theta),s= sin(d_theta);
-    while (x > y) {
-        double temp=(x*c)-(y*s);
-        y = (x * s) + (y * c);
-        x = temp;
-        draw8points(hdc,xc,yc, Round(x),Round(y),color);
-    }
-}
-/* Bresenham Algorithm1 for circle
- * Description:
- * This code implements the Bresenham's Algorithm for drawing a circle efficiently on a 2D grid.
- * The algorithm avoids the need for expensive trigonometric calculations by using integer arithmetic and taking advantage of the symmetry properties of circles.
- * It starts from the topmost point of the circle and iteratively calculates the positions of points in 8 octants, incrementally drawing the circle.
- * The decision parameter is updated based on the distance of the current point from the ideal circle, determining whether to move horizontally or diagonally.
- * This approach minimizes computational overhead and produces accurate circle approximatio
- * */
-void DrawCircleBresenham1Algorithm(HDC hdc ,int xc,int yc,int r,COLORREF color){
-    int x=0 , y=r;
-    draw8points(hdc,xc,yc, Round(x),Round(y),color);
-    int d=1-r;
-    while (x<y){
-        int d_ch1=(2*x)+3;
-        int d_ch2=2*(x-y)+5;
-        if (d<0){
-            d+=d_ch1;
-        }else{
-            y--;
-            d+=d_ch2;
-        }
-        x++;
-        draw8points(hdc,xc,yc, Round(x),Round(y),color);
-    }
-
-}
-/* Bresenham Algorithm1 for circle
- * Description:
- * This code implements a variation of Bresenham's Algorithm for drawing a circle efficiently on a 2D grid.
- * Compared to the original algorithm, this version optimizes the calculation of decision parameters to further reduce computational overhead.
- * It starts from the topmost point of the circle and iteratively calculates the positions of points in 8 octants, incrementally drawing the circle.
- * The decision parameter is updated based on the distance of the current point from the ideal circle, determining whether to move horizontally or diagonally.
- * This approach minimizes computational overhead and produces accurate circle approximations.
- * */
-void DrawCircleBresenham2Algorithm(HDC hdc ,int xc,int yc,int r,COLORREF color){
-    int x=0 , y=r;
-    draw8points(hdc,xc,yc, Round(x),Round(y),color);
-    int d=1-r;
-    int d_ch1=3;
-    int d_ch2=5-(2*r);
-    while (x<y){
-        if (d<0){
-            d+=d_ch1;
-            d_ch2+=2;
-        }else{
-            d+=d_ch2;
-            d_ch2+=4;
-            y--;
-        }
-        x++;
-        d_ch1+=2;
-        draw8points(hdc,xc,yc, Round(x),Round(y),color);
-    }
-}
-
 void DrawSmileFace(HDC hdc ,int xc,int yc,int r,COLORREF color){
     int X_coordinate = r * cos(45);
     DrawCircleBresenham2Algorithm(hdc, xc, yc, r, RGB(0, 0, 0));
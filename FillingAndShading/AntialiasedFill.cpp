@@ -0,0 +1,172 @@
+#include "AntialiasedFill.h"
+#include <math.h>
+#include <climits>
+
+/*
+* AccumulateLine
+* Description: Add the signed area of one edge piece that lies inside [0, width] horizontally
+* parameter: CoverageBuffer acc, int height, double x0, double y0, double x1, double y1
+*/
+static void AccumulateLine(CoverageBuffer &acc,int height,double x0,double y0,double x1,double y1){
+    if (y0==y1)return;
+    double dir=1;
+    if (y0>y1){
+        std::swap(x0,x1);
+        std::swap(y0,y1);
+        dir=-1;
+    }
+    double dxdy=(x1-x0)/(y1-y0);
+    double x=x0;
+    int ystart=(int)floor(y0);
+    if (ystart<acc.ybegin){
+        x+=(acc.ybegin-y0)*dxdy;
+        ystart=acc.ybegin;
+    }
+    int yend=std::min((int)ceil(y1),height);
+    int stride=acc.width+2;
+    for (int y=ystart;y<yend;y++){
+        int row=y-acc.ybegin;
+        float *line=&acc.cells[(size_t)row*stride];
+        //height of the piece inside this row and where it leaves the row
+        double dy=std::min((double)y+1,y1)-std::max((double)y,y0);
+        double xnext=x+dxdy*dy;
+        double d=dy*dir;
+        double xa=std::min(x,xnext),xb=std::max(x,xnext);
+        double xaFloor=floor(xa);
+        int xai=(int)xaFloor;
+        double xbCeil=ceil(xb);
+        int xbi=(int)xbCeil;
+        acc.xmin[row]=std::min(acc.xmin[row],xai);
+        if (xbi<=xai+1){
+            //the piece stays inside one cell: split its area between this cell and the next
+            double xmf=0.5*(x+xnext)-xaFloor;
+            line[xai]+=(float)(d-d*xmf);
+            line[xai+1]+=(float)(d*xmf);
+            acc.xmax[row]=std::max(acc.xmax[row],xai+1);
+        }else{
+            //the piece crosses several cells: the area grows as a triangle in the first cell, by the
+            //same amount per cell in the middle ones and as a trapezoid in the last one
+            double s=1.0/(xb-xa);
+            double xaf=xa-xaFloor;
+            double a0=0.5*s*(1-xaf)*(1-xaf);
+            double xbf=xb-xbCeil+1;
+            double am=0.5*s*xbf*xbf;
+            line[xai]+=(float)(d*a0);
+            if (xbi==xai+2){
+                line[xai+1]+=(float)(d*(1-a0-am));
+            }else{
+                double a1=s*(1.5-xaf);
+                line[xai+1]+=(float)(d*(a1-a0));
+                for (int xi=xai+2;xi<xbi-1;xi++)
+                    line[xi]+=(float)(d*s);
+                double a2=a1+(xbi-xai-3)*s;
+                line[xbi-1]+=(float)(d*(1-a2-am));
+            }
+            line[xbi]+=(float)(d*am);
+            acc.xmax[row]=std::max(acc.xmax[row],xbi);
+        }
+        x=xnext;
+    }
+}
+
+/*
+* AccumulateEdge
+* Description: Add the signed area an edge contributes to every cell it crosses, split at the left and
+*              right border of the framebuffer with the outside pieces moved onto the border
+* parameter: CoverageBuffer acc, int height, double x0, double y0, double x1, double y1
+*/
+void AccumulateEdge(CoverageBuffer &acc,int height,double x0,double y0,double x1,double y1){
+    if (y0==y1)return;
+    double w=acc.width;
+    //parameters where the edge crosses x=0 and x=width
+    double t[4]={0,1,1,1};
+    int count=1;
+    if (x0!=x1){
+        double t0=(0-x0)/(x1-x0),tw=(w-x0)/(x1-x0);
+        if (t0>0 && t0<1)t[count++]=t0;
+        if (tw>0 && tw<1)t[count++]=tw;
+    }
+    t[count++]=1;
+    std::sort(t,t+count);
+    for (int i=0;i+1<count;i++){
+        double xa=x0+(x1-x0)*t[i],ya=y0+(y1-y0)*t[i];
+        double xb=x0+(x1-x0)*t[i+1],yb=y0+(y1-y0)*t[i+1];
+        xa=std::min(std::max(xa,0.0),w);
+        xb=std::min(std::max(xb,0.0),w);
+        AccumulateLine(acc,height,xa,ya,xb,yb);
+    }
+}
+
+/*
+* Coverage
+* Description: Turn an accumulated signed area into a coverage in [0,1] for the fill rule
+* parameter: float area, FillRule rule
+*/
+static inline float Coverage(float area,FillRule rule){
+    area=fabsf(area);
+    if (rule==FILL_NON_ZERO)
+        return area<1 ? area : 1;
+    area=fmodf(area,2);
+    return area>1 ? 2-area : area;
+}
+
+/*
+* AntialiasedFill
+* Description: Fill any polygon with antialiased edges from the exact pixel coverage of the polygon
+* parameter: Framebuffer fb, point p[], int n, uint32_t pixel, FillRule rule
+*/
+void AntialiasedFill(Framebuffer &fb,point p[],int n,uint32_t pixel,FillRule rule){
+    if (n<3 || fb.width<=0)return;
+    int ymin=p[0].y,ymax=p[0].y;
+    for (int i=1;i<n;i++){
+        ymin=std::min(ymin,p[i].y);
+        ymax=std::max(ymax,p[i].y);
+    }
+    ymin=std::max(ymin,0);
+    ymax=std::min(ymax,fb.height);
+    if (ymin>=ymax)return;
+
+    //the buffer only covers the rows of the polygon and is kept between calls, one per thread
+    thread_local CoverageBuffer acc;
+    int rows=ymax-ymin,stride=fb.width+2;
+    acc.width=fb.width;
+    acc.ybegin=ymin;
+    if (acc.cells.size()<(size_t)rows*stride)
+        acc.cells.assign((size_t)rows*stride,0.0f);
+    acc.xmin.assign(rows,INT_MAX);
+    acc.xmax.assign(rows,INT_MIN);
+
+    //start with last point
+    point v1=p[n-1];
+    for (int i=0;i<n;i++){
+        point v2=p[i];
+        AccumulateEdge(acc,fb.height,v1.x,v1.y,v2.x,v2.y);
+        v1=v2;
+    }
+
+    //prefix sum per row over the touched cells, blend by coverage and clear the cells for the next call
+    int sr=(pixel>>16)&0xFF,sg=(pixel>>8)&0xFF,sb=pixel&0xFF;
+    for (int row=0;row<rows;row++){
+        if (acc.xmin[row]>acc.xmax[row])continue;
+        float *line=&acc.cells[(size_t)row*stride];
+        uint32_t *out=fb.Row(ymin+row);
+        float area=0;
+        for (int x=acc.xmin[row];x<=acc.xmax[row];x++){
+            area+=line[x];
+            line[x]=0;
+            if (x>=fb.width)continue;
+            float cov=Coverage(area,rule);
+            if (cov<=1.0f/512)continue;
+            if (cov>=1-1.0f/512){
+                out[x]=pixel;
+                continue;
+            }
+            uint32_t dst=out[x];
+            int dr=(dst>>16)&0xFF,dg=(dst>>8)&0xFF,db=dst&0xFF;
+            dr+=(int)((sr-dr)*cov+0.5f);
+            dg+=(int)((sg-dg)*cov+0.5f);
+            db+=(int)((sb-db)*cov+0.5f);
+            out[x]=(dst&0xFF000000u)|(dr<<16)|(dg<<8)|db;
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef FILLINGANDSHADING_ANTIALIASEDFILL_H
+#define FILLINGANDSHADING_ANTIALIASEDFILL_H
+
+#include <vector>
+#include "Raster.h"
+#include "PolygonFill.h"
+
+/*
+* struct CoverageBuffer
+* Description: sparse accumulation buffer of the antialiased fill, only the rows the polygon spans are
+*              kept and for every row only the columns an edge touched are resolved
+* width: framebuffer width, a row has width+2 cells so an edge ending on the right border has room
+* ybegin: framebuffer row of the first buffer row
+* cells: signed area accumulated per cell
+* xmin, xmax: first and last touched cell of every row
+*/
+struct CoverageBuffer {
+    int width=0,ybegin=0;
+    std::vector<float> cells;
+    std::vector<int> xmin,xmax;
+};
+
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+
+/*
+* AccumulateEdge
+* Description: Add the signed area an edge contributes to every cell it crosses. Along each row the edge
+*              piece spreads its height (negative when the edge goes up) over the cells it passes
+*              through by the exact area right of the edge in each cell, so after a prefix sum along the
+*              row every cell holds the signed area of its pixel covered by the polygon. The edge is
+*              split where it leaves the framebuffer on the left/right and the outside pieces are moved
+*              onto the border, which keeps the coverage of the visible pixels exact.
+* parameter: CoverageBuffer acc, int height, double x0, double y0, double x1, double y1
+*/
+void AccumulateEdge(CoverageBuffer &acc,int height,double x0,double y0,double x1,double y1);
+/*
+* AntialiasedFill
+* Description: Fill any polygon with antialiased edges without supersampling: the exact area of every
+*              pixel square [x,x+1)x[y,y+1) inside the polygon is accumulated from the edges into a
+*              CoverageBuffer, resolved with a prefix sum per row and the fill color is blended over the
+*              framebuffer by that coverage. Non zero uses min(|area|, 1), even odd folds the area
+*              over 2 so overlapping parts cancel like GeneralPolygonFill. The coverage buffer is
+*              thread_local, reused between calls and never shared between threads.
+* parameter: Framebuffer fb, point p[], int n, uint32_t pixel, FillRule rule
+*/
+void AntialiasedFill(Framebuffer &fb,point p[],int n,uint32_t pixel,FillRule rule);
+
+#endif //FILLINGANDSHADING_ANTIALIASEDFILL_H
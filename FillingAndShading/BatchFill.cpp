@@ -0,0 +1,43 @@
+#include "BatchFill.h"
+#include "ConvexFill.h"
+#include "Parallel.h"
+
+/*
+* BatchConvexFill
+* Description: Fill many convex polygons with one worker per band of rows, keeping submission order per pixel
+* parameter: Framebuffer fb, vector<BatchPolygon> polygons, int threads (0 = one per hardware thread)
+*/
+void BatchConvexFill(Framebuffer &fb,const std::vector<BatchPolygon> &polygons,int threads){
+    if (fb.height<=0 || polygons.empty())return;
+    int bands=(fb.height+BATCH_BAND_ROWS-1)/BATCH_BAND_ROWS;
+
+    //bin the polygons to the bands they overlap, in submission order
+    std::vector<std::vector<int>> bins(bands);
+    for (int i=0;i<(int)polygons.size();i++){
+        const BatchPolygon &poly=polygons[i];
+        if (poly.n<3)continue;
+        int ymin=poly.p[0].y,ymax=poly.p[0].y;
+        for (int k=1;k<poly.n;k++){
+            ymin=std::min(ymin,poly.p[k].y);
+            ymax=std::max(ymax,poly.p[k].y);
+        }
+        //a polygon covers rows [ymin, ymax)
+        ymin=std::max(ymin,0);
+        ymax=std::min(ymax,fb.height);
+        if (ymin>=ymax)continue;
+        for (int b=ymin/BATCH_BAND_ROWS;b<=(ymax-1)/BATCH_BAND_ROWS;b++)
+            bins[b].push_back(i);
+    }
+
+    //workers take the next unfilled band until none is left, each with its own table
+    ParallelFor(bands,threads,[&](int b){
+        thread_local Table t;
+        int ybegin=b*BATCH_BAND_ROWS,yend=std::min(ybegin+BATCH_BAND_ROWS,fb.height);
+        for (int i : bins[b]){
+            const BatchPolygon &poly=polygons[i];
+            InitTable(t,fb.height);
+            polygonToTableInteger(poly.p,poly.n,t,ybegin,yend);
+            tableToScreen(fb,t,poly.pixel);
+        }
+    });
+}
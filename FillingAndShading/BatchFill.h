@@ -0,0 +1,41 @@
+#ifndef FILLINGANDSHADING_BATCHFILL_H
+#define FILLINGANDSHADING_BATCHFILL_H
+
+#include <vector>
+#include "Raster.h"
+
+/*
+* BATCH_BAND_ROWS
+* Description: height of the horizontal bands the framebuffer is split into for BatchConvexFill, there
+*              are more bands than workers so a band full of polygons does not stall the others
+*/
+#define BATCH_BAND_ROWS 64
+
+/*
+* struct BatchPolygon
+* p: vertices of a convex polygon, the array must stay alive during the fill
+* n: number of vertices
+* pixel: packed fill pixel
+*/
+struct BatchPolygon {
+    const point *p;
+    int n;
+    uint32_t pixel;
+};
+
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+
+/*
+* BatchConvexFill
+* Description: Fill many convex polygons with several threads. The framebuffer is split into bands of
+*              BATCH_BAND_ROWS rows, the polygons are binned to the bands their rows overlap in submission
+*              order, and every band is filled by exactly one worker which only touches the rows it owns.
+*              Inside a band the polygons are filled in submission order, so every pixel ends up with
+*              the same color as calling ConvexFill for the polygons one after the other.
+* parameter: Framebuffer fb, vector<BatchPolygon> polygons, int threads (0 = one per hardware thread)
+*/
+void BatchConvexFill(Framebuffer &fb,const std::vector<BatchPolygon> &polygons,int threads = 0);
+
+#endif //FILLINGANDSHADING_BATCHFILL_H
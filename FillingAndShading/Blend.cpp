@@ -0,0 +1,245 @@
+#include "Blend.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BLEND_AVX2 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BLEND_SSE2 1
+#endif
+
+/*
+* Div255
+* Description: Round a product of two 8 bit values divided by 255 exactly, with shifts instead of a division
+* parameter: int t
+*/
+static inline int Div255(int t){
+    t+=128;
+    return (t+(t>>8))>>8;
+}
+
+/*
+* BlendChannel
+* Description: Blend one 8 bit channel, sa and da are the source and destination alpha
+* parameter: int s, int d, int sa, int da, BlendMode mode
+*/
+static inline int BlendChannel(int s,int d,int sa,int da,BlendMode mode){
+    int r;
+    switch (mode){
+        case BLEND_SOURCE_OVER: r=s+Div255(d*(255-sa)); break;
+        case BLEND_MULTIPLY: r=Div255(s*d)+Div255(s*(255-da))+Div255(d*(255-sa)); break;
+        case BLEND_SCREEN: r=s+d-Div255(s*d); break;
+        default: r=s+d; break;
+    }
+    return r<255 ? r : 255;
+}
+
+/*
+* BlendScalar
+* Description: Blend one premultiplied pixel over another
+* parameter: uint32_t d, uint32_t s, BlendMode mode
+*/
+static inline uint32_t BlendScalar(uint32_t d,uint32_t s,BlendMode mode){
+    int sa=s>>24,da=d>>24;
+    uint32_t r=0;
+    for (int shift=0;shift<32;shift+=8)
+        r|=(uint32_t)BlendChannel((s>>shift)&0xFF,(d>>shift)&0xFF,sa,da,mode)<<shift;
+    return r;
+}
+
+#ifdef BLEND_SSE2
+/*
+* Div255SSE2
+* Description: Div255 on 8 16 bit lanes
+* parameter: __m128i t
+*/
+static inline __m128i Div255SSE2(__m128i t){
+    t=_mm_add_epi16(t,_mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t,_mm_srli_epi16(t,8)),8);
+}
+
+/*
+* AlphaSSE2
+* Description: Copy the alpha of each of the 2 pixels in 16 bit lanes to its 4 channels
+* parameter: __m128i p
+*/
+static inline __m128i AlphaSSE2(__m128i p){
+    p=_mm_shufflelo_epi16(p,_MM_SHUFFLE(3,3,3,3));
+    return _mm_shufflehi_epi16(p,_MM_SHUFFLE(3,3,3,3));
+}
+
+/*
+* BlendHalfSSE2
+* Description: Blend 2 pixels widened to 16 bit lanes, same arithmetic as BlendChannel
+* parameter: __m128i d, __m128i s, BlendMode mode
+*/
+static inline __m128i BlendHalfSSE2(__m128i d,__m128i s,BlendMode mode){
+    const __m128i full=_mm_set1_epi16(255);
+    switch (mode){
+        case BLEND_SOURCE_OVER:
+            return _mm_add_epi16(s,Div255SSE2(_mm_mullo_epi16(d,_mm_sub_epi16(full,AlphaSSE2(s)))));
+        case BLEND_MULTIPLY:
+            return _mm_add_epi16(_mm_add_epi16(Div255SSE2(_mm_mullo_epi16(s,d)),
+                                               Div255SSE2(_mm_mullo_epi16(s,_mm_sub_epi16(full,AlphaSSE2(d))))),
+                                 Div255SSE2(_mm_mullo_epi16(d,_mm_sub_epi16(full,AlphaSSE2(s)))));
+        case BLEND_SCREEN:
+            return _mm_sub_epi16(_mm_add_epi16(s,d),Div255SSE2(_mm_mullo_epi16(s,d)));
+        default:
+            return _mm_add_epi16(s,d);
+    }
+}
+
+/*
+* BlendSSE2
+* Description: Blend 4 premultiplied pixels, the results are saturated to 255 when packed back to bytes
+* parameter: __m128i d, __m128i s, BlendMode mode
+*/
+static inline __m128i BlendSSE2(__m128i d,__m128i s,BlendMode mode){
+    const __m128i zero=_mm_setzero_si128();
+    __m128i lo=BlendHalfSSE2(_mm_unpacklo_epi8(d,zero),_mm_unpacklo_epi8(s,zero),mode);
+    __m128i hi=BlendHalfSSE2(_mm_unpackhi_epi8(d,zero),_mm_unpackhi_epi8(s,zero),mode);
+    return _mm_packus_epi16(lo,hi);
+}
+#endif
+
+#ifdef BLEND_AVX2
+/*
+* Div255AVX2
+* Description: Div255 on 16 16 bit lanes
+* parameter: __m256i t
+*/
+static inline __m256i Div255AVX2(__m256i t){
+    t=_mm256_add_epi16(t,_mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(t,_mm256_srli_epi16(t,8)),8);
+}
+
+/*
+* AlphaAVX2
+* Description: Copy the alpha of each of the 4 pixels in 16 bit lanes to its 4 channels
+* parameter: __m256i p
+*/
+static inline __m256i AlphaAVX2(__m256i p){
+    p=_mm256_shufflelo_epi16(p,_MM_SHUFFLE(3,3,3,3));
+    return _mm256_shufflehi_epi16(p,_MM_SHUFFLE(3,3,3,3));
+}
+
+/*
+* BlendHalfAVX2
+* Description: Blend 4 pixels widened to 16 bit lanes, same arithmetic as BlendChannel
+* parameter: __m256i d, __m256i s, BlendMode mode
+*/
+static inline __m256i BlendHalfAVX2(__m256i d,__m256i s,BlendMode mode){
+    const __m256i full=_mm256_set1_epi16(255);
+    switch (mode){
+        case BLEND_SOURCE_OVER:
+            return _mm256_add_epi16(s,Div255AVX2(_mm256_mullo_epi16(d,_mm256_sub_epi16(full,AlphaAVX2(s)))));
+        case BLEND_MULTIPLY:
+            return _mm256_add_epi16(_mm256_add_epi16(Div255AVX2(_mm256_mullo_epi16(s,d)),
+                                                     Div255AVX2(_mm256_mullo_epi16(s,_mm256_sub_epi16(full,AlphaAVX2(d))))),
+                                    Div255AVX2(_mm256_mullo_epi16(d,_mm256_sub_epi16(full,AlphaAVX2(s)))));
+        case BLEND_SCREEN:
+            return _mm256_sub_epi16(_mm256_add_epi16(s,d),Div255AVX2(_mm256_mullo_epi16(s,d)));
+        default:
+            return _mm256_add_epi16(s,d);
+    }
+}
+
+/*
+* BlendAVX2
+* Description: Blend 8 premultiplied pixels, unpack and pack work per 128 bit lane so the order is kept
+* parameter: __m256i d, __m256i s, BlendMode mode
+*/
+static inline __m256i BlendAVX2(__m256i d,__m256i s,BlendMode mode){
+    const __m256i zero=_mm256_setzero_si256();
+    __m256i lo=BlendHalfAVX2(_mm256_unpacklo_epi8(d,zero),_mm256_unpacklo_epi8(s,zero),mode);
+    __m256i hi=BlendHalfAVX2(_mm256_unpackhi_epi8(d,zero),_mm256_unpackhi_epi8(s,zero),mode);
+    return _mm256_packus_epi16(lo,hi);
+}
+#endif
+
+/*
+* Premultiply
+* Description: Convert a straight alpha pixel to premultiplied alpha
+* parameter: uint32_t pixel
+*/
+uint32_t Premultiply(uint32_t pixel){
+    int a=pixel>>24;
+    int r=Div255(((pixel>>16)&0xFF)*a),g=Div255(((pixel>>8)&0xFF)*a),b=Div255((pixel&0xFF)*a);
+    return ((uint32_t)a<<24)|(r<<16)|(g<<8)|b;
+}
+
+/*
+* BlendSpan
+* Description: Blend one premultiplied source pixel into count framebuffer pixels
+* parameter: uint32_t dst[], int count, uint32_t src, BlendMode mode
+*/
+void BlendSpan(uint32_t dst[],int count,uint32_t src,BlendMode mode){
+    int i=0;
+#ifdef BLEND_AVX2
+    __m256i s8=_mm256_set1_epi32((int)src);
+    for (;i+8<=count;i+=8){
+        __m256i d=_mm256_loadu_si256((const __m256i *)(dst+i));
+        _mm256_storeu_si256((__m256i *)(dst+i),BlendAVX2(d,s8,mode));
+    }
+#endif
+#ifdef BLEND_SSE2
+    __m128i s4=_mm_set1_epi32((int)src);
+    for (;i+4<=count;i+=4){
+        __m128i d=_mm_loadu_si128((const __m128i *)(dst+i));
+        _mm_storeu_si128((__m128i *)(dst+i),BlendSSE2(d,s4,mode));
+    }
+#endif
+    for (;i<count;i++)
+        dst[i]=BlendScalar(dst[i],src,mode);
+}
+
+/*
+* BlendSpan
+* Description: Blend count premultiplied source pixels into count framebuffer pixels
+* parameter: uint32_t dst[], const uint32_t src[], int count, BlendMode mode
+*/
+void BlendSpan(uint32_t dst[],const uint32_t src[],int count,BlendMode mode){
+    int i=0;
+#ifdef BLEND_AVX2
+    for (;i+8<=count;i+=8){
+        __m256i d=_mm256_loadu_si256((const __m256i *)(dst+i));
+        __m256i s=_mm256_loadu_si256((const __m256i *)(src+i));
+        _mm256_storeu_si256((__m256i *)(dst+i),BlendAVX2(d,s,mode));
+    }
+#endif
+#ifdef BLEND_SSE2
+    for (;i+4<=count;i+=4){
+        __m128i d=_mm_loadu_si128((const __m128i *)(dst+i));
+        __m128i s=_mm_loadu_si128((const __m128i *)(src+i));
+        _mm_storeu_si128((__m128i *)(dst+i),BlendSSE2(d,s,mode));
+    }
+#endif
+    for (;i<count;i++)
+        dst[i]=BlendScalar(dst[i],src[i],mode);
+}
+
+/*
+* BlendPixel
+* Description: Blend one premultiplied pixel at (x,y), pixels outside the framebuffer are ignored
+* parameter: Framebuffer fb, int x, int y, uint32_t src, BlendMode mode
+*/
+void BlendPixel(Framebuffer &fb,int x,int y,uint32_t src,BlendMode mode){
+    if ((unsigned)x>=(unsigned)fb.width || (unsigned)y>=(unsigned)fb.height)return;
+    uint32_t &d=fb.Row(y)[x];
+    d=BlendScalar(d,src,mode);
+}
+
+/*
+* tableToScreenBlend
+* Description: Take table blend one premultiplied pixel into every row span of the framebuffer
+* parameter: Framebuffer fb, Table t, uint32_t src, BlendMode mode
+*/
+void tableToScreenBlend(Framebuffer &fb,const Table &t,uint32_t src,BlendMode mode){
+    for (int i=t.ymin;i<=t.ymax;i++){
+        if ((unsigned)i>=(unsigned)fb.height)continue;
+        int xleft=std::max(t.rows[i].xleft,0),xright=std::min(t.rows[i].xright,fb.width);
+        if (xleft<xright)
+            BlendSpan(fb.Row(i)+xleft,xright-xleft,src,mode);
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef FILLINGANDSHADING_BLEND_H
+#define FILLINGANDSHADING_BLEND_H
+
+#include <stdint.h>
+#include "Raster.h"
+#include "ConvexFill.h"
+
+/*
+* enum BlendMode
+* Description: how a premultiplied source pixel s is combined with the premultiplied framebuffer pixel d,
+*              every channel (alpha included) in [0,1]:
+*              BLEND_SOURCE_OVER: s + d*(1-sa)
+*              BLEND_MULTIPLY: s*d + s*(1-da) + d*(1-sa)
+*              BLEND_SCREEN: s + d - s*d
+*              BLEND_ADD: min(s + d, 1)
+*/
+enum BlendMode {
+    BLEND_SOURCE_OVER,
+    BLEND_MULTIPLY,
+    BLEND_SCREEN,
+    BLEND_ADD
+};
+
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+
+/*
+* Premultiply
+* Description: Convert a straight alpha pixel 0xAARRGGBB to premultiplied alpha
+* parameter: uint32_t pixel
+*/
+uint32_t Premultiply(uint32_t pixel);
+/*
+* BlendSpan
+* Description: Blend one premultiplied source pixel into count framebuffer pixels. The span is done 8 pixels
+*              at a time with AVX2 or 4 at a time with SSE2 when the compiler targets them, and the
+*              scalar code gives bit identical results for the rest and on other targets.
+* parameter: uint32_t dst[], int count, uint32_t src, BlendMode mode
+*/
+void BlendSpan(uint32_t dst[],int count,uint32_t src,BlendMode mode);
+/*
+* BlendSpan
+* Description: Blend count premultiplied source pixels into count framebuffer pixels, same kernels as above
+* parameter: uint32_t dst[], const uint32_t src[], int count, BlendMode mode
+*/
+void BlendSpan(uint32_t dst[],const uint32_t src[],int count,BlendMode mode);
+/*
+* BlendPixel
+* Description: Blend one premultiplied pixel at (x,y), pixels outside the framebuffer are ignored. This is
+*              the entry for rasterizers that plot single pixels.
+* parameter: Framebuffer fb, int x, int y, uint32_t src, BlendMode mode
+*/
+void BlendPixel(Framebuffer &fb,int x,int y,uint32_t src,BlendMode mode);
+/*
+* tableToScreenBlend
+* Description: Take table blend one premultiplied pixel into every row span of the framebuffer
+* parameter: Framebuffer fb, Table t, uint32_t src, BlendMode mode
+*/
+void tableToScreenBlend(Framebuffer &fb,const Table &t,uint32_t src,BlendMode mode);
+
+#endif //FILLINGANDSHADING_BLEND_H
@@ -0,0 +1,296 @@
+#include "ConvexFill.h"
+#include <math.h>
+
+/*
+* InitTable
+* Description: Initialize table for a surface of the given height, only the rows used by the previous
+*              polygon are reset unless the height changed
+* parameter: Table t, int height
+*/
+void InitTable(Table &t,int height){
+    EdgeRecord empty={INT_MAX,INT_MIN};
+    if ((int)t.rows.size()!=height){
+        t.rows.assign(height,empty);
+    }else{
+        for (int i=t.ymin;i<=t.ymax;i++)
+            t.rows[i]=empty;
+    }
+    t.ymin=height;
+    t.ymax=-1;
+}
+
+/*
+* Swap
+* Description: Swap two points
+* parameter: int x1, int y1, int x2, int y2
+*/
+void Swap(int &x1, int &y1, int &x2, int &y2)
+{
+    x1 ^= x2;
+    x2 ^= x1;
+    x1 ^= x2;
+
+    y1 ^= y2;
+    y2 ^= y1;
+    y1 ^= y2;
+}
+/*
+* EdgeToTable
+* Description: Take edge update table, rows outside the table are skipped
+* parameter: point p1, point p2, Table t
+*/
+void EdgeToTable(point p1,point p2,Table &t){
+    //horizontal
+    if (p1.y==p2.y)return;
+
+    if (p1.y>p2.y){
+        Swap(p1.x,p1.y,p2.x,p2.y);
+    }
+    double x=p1.x; int y=p1.y;
+    double dx=p2.x-p1.x, dy=p2.y-p1.y;
+    double mi=dx/dy;
+
+    //clip the edge to the rows of the table
+    int yend=p2.y<(int)t.rows.size() ? p2.y : (int)t.rows.size();
+    if (y<0){
+        x+=mi*(0-y);
+        y=0;
+    }
+    if (y>=yend)return;
+    if (y<t.ymin)t.ymin=y;
+    if (yend-1>t.ymax)t.ymax=yend-1;
+
+    //connect the two points by a line one of them is the floor y and the other is the celling y
+    while (y<yend){
+        // floor will be out side the polygon and inside it so we take the celling
+        if (x<t.rows[y].xleft){
+            t.rows[y].xleft=(int)ceil(x);//update table
+        }
+        // ceil will be out side the polygon and inside it so we take the floor
+        if (x>t.rows[y].xright){
+            t.rows[y].xright=(int)floor(x);//update table
+        }
+        y++;
+        x+=mi;
+    }
+}
+
+/*
+* EdgeToTableInteger
+* Description: Take edge update table like EdgeToTable but walk the edge with integers only, x is kept as
+*              an integer part and a remainder over dy (Bresenham style) so ceil/floor are exact
+* parameter: point p1, point p2, Table t
+*/
+void EdgeToTableInteger(point p1,point p2,Table &t){
+    EdgeToTableInteger(p1,p2,t,0,(int)t.rows.size());
+}
+
+/*
+* EdgeToTableInteger
+* Description: Take edge update only the rows [ybegin, yend) of the table with the integer edge walker
+* parameter: point p1, point p2, Table t, int ybegin, int yend
+*/
+void EdgeToTableInteger(point p1,point p2,Table &t,int ybegin,int yend){
+    //horizontal
+    if (p1.y==p2.y)return;
+
+    if (p1.y>p2.y){
+        Swap(p1.x,p1.y,p2.x,p2.y);
+    }
+    int dx=p2.x-p1.x, dy=p2.y-p1.y;
+    //x step per row = step + stepRem/dy with 0 <= stepRem < dy
+    int step=dx/dy, stepRem=dx%dy;
+    if (stepRem<0){
+        step--;
+        stepRem+=dy;
+    }
+
+    //clip the edge to the requested rows of the table
+    if (ybegin<0)ybegin=0;
+    if (yend>(int)t.rows.size())yend=(int)t.rows.size();
+    if (p2.y<yend)yend=p2.y;
+    int y=p1.y>ybegin ? p1.y : ybegin;
+    if (y>=yend)return;
+    if (y<t.ymin)t.ymin=y;
+    if (yend-1>t.ymax)t.ymax=yend-1;
+
+    //x at the first row = x + rem/dy with 0 <= rem < dy
+    long long num=(long long)p1.x*dy+(long long)(y-p1.y)*dx;
+    long long q=num/dy, r=num%dy;
+    if (r<0){
+        q--;
+        r+=dy;
+    }
+    int x=(int)q, rem=(int)r;
+
+    while (y<yend){
+        // the exact x is x+rem/dy, its ceil is x+1 whenever there is a remainder
+        int xceil=rem ? x+1 : x;
+        if (xceil<t.rows[y].xleft){
+            t.rows[y].xleft=xceil;//update table
+        }
+        if (x>t.rows[y].xright){
+            t.rows[y].xright=x;//update table
+        }
+        y++;
+        x+=step;
+        rem+=stepRem;
+        if (rem>=dy){
+            rem-=dy;
+            x++;
+        }
+    }
+}
+
+/*
+* polygonToTable
+* Description: Take polygon update table
+* parameter: point p[], int n, Table t
+*/
+void polygonToTable(point p[],int n,Table &t){
+    //start with last point
+    point v1=p[n-1];
+    for (int i=0;i<n;i++){
+        point v2=p[i];
+        EdgeToTable(v1,v2,t);
+        v1=v2;
+    }
+}
+/*
+* polygonToTableInteger
+* Description: Take polygon update table with the integer edge walker
+* parameter: point p[], int n, Table t
+*/
+void polygonToTableInteger(point p[],int n,Table &t){
+    //start with last point
+    point v1=p[n-1];
+    for (int i=0;i<n;i++){
+        point v2=p[i];
+        EdgeToTableInteger(v1,v2,t);
+        v1=v2;
+    }
+}
+/*
+* polygonToTableInteger
+* Description: Take polygon update only the rows [ybegin, yend) of the table with the integer edge walker
+* parameter: point p[], int n, Table t, int ybegin, int yend
+*/
+void polygonToTableInteger(const point p[],int n,Table &t,int ybegin,int yend){
+    //start with last point
+    point v1=p[n-1];
+    for (int i=0;i<n;i++){
+        point v2=p[i];
+        EdgeToTableInteger(v1,v2,t,ybegin,yend);
+        v1=v2;
+    }
+}
+/*
+* tableToScreen
+* Description: Take table update screen, only the rows between ymin and ymax are visited
+* parameter: HDC hdc, Table t, COLORREF color
+*/
+void tableToScreen(HDC hdc,const Table &t,COLORREF color){
+    for (int i=t.ymin;i<=t.ymax;i++) {
+        if(t.rows[i].xleft<t.rows[i].xright){
+            for (int x=t.rows[i].xleft;x<t.rows[i].xright;x++){
+                SetPixel(hdc,x,i,color);
+            }
+        }
+
+    }
+}
+/*
+* tableToScreen
+* Description: Take table write every row span into the framebuffer
+* parameter: Framebuffer fb, Table t, uint32_t pixel
+*/
+void tableToScreen(Framebuffer &fb,const Table &t,uint32_t pixel){
+    for (int i=t.ymin;i<=t.ymax;i++) {
+        if(t.rows[i].xleft<t.rows[i].xright){
+            FillSpan(fb,i,t.rows[i].xleft,t.rows[i].xright,pixel);
+        }
+    }
+}
+/*
+* ConvexFill
+* Description: Fill convex polygon by initalize table and update it with polygon points then update screen,
+*              the table is sized to the clip box of the device context and built with the integer edge walker,
+*              it is thread_local so it is reused between calls and every thread fills with its own
+* parameter: HDC hdc, point p[], int n, COLORREF color
+*/
+void ConvexFill(HDC hdc,point p[],int n,COLORREF color){
+    thread_local Table t;
+    RECT clip;
+    if (GetClipBox(hdc,&clip)==ERROR)return;
+    InitTable(t,clip.bottom>0 ? clip.bottom : 0);
+    polygonToTableInteger(p,n,t);
+    tableToScreen(hdc,t,color);
+}
+/*
+* ConvexFill
+* Description: Fill convex polygon into the framebuffer, with a thread_local table like the HDC version
+*              so it can be called from several threads (on different framebuffers or rows)
+* parameter: Framebuffer fb, point p[], int n, uint32_t pixel
+*/
+void ConvexFill(Framebuffer &fb,point p[],int n,uint32_t pixel){
+    thread_local Table t;
+    InitTable(t,fb.height);
+    polygonToTableInteger(p,n,t);
+    tableToScreen(fb,t,pixel);
+}
+/*
+* IncrementalFillBegin
+* Description: Fill convex polygon into the framebuffer and keep its table and vertices for later moves
+* parameter: Framebuffer fb, IncrementalFill f, point p[], int n, uint32_t pixel, uint32_t background
+*/
+void IncrementalFillBegin(Framebuffer &fb,IncrementalFill &f,const point p[],int n,uint32_t pixel,uint32_t background){
+    f.p.assign(p,p+n);
+    f.pixel=pixel;
+    f.background=background;
+    InitTable(f.t,fb.height);
+    polygonToTableInteger(f.p.data(),n,f.t);
+    tableToScreen(fb,f.t,pixel);
+}
+/*
+* IncrementalMoveVertex
+* Description: Move vertex k, recompute the rows of its two edges and paint only the span differences
+* parameter: Framebuffer fb, IncrementalFill f, int k, point np
+*/
+void IncrementalMoveVertex(Framebuffer &fb,IncrementalFill &f,int k,point np){
+    int n=(int)f.p.size();
+    if (n<3 || k<0 || k>=n)return;
+    Table &t=f.t;
+    int prev=f.p[(k+n-1)%n].y,next=f.p[(k+1)%n].y;
+    //rows of the two edges before and after the move, an edge covers [ytop, ybottom)
+    int ybegin=std::min(std::min(prev,next),std::min(f.p[k].y,np.y));
+    int yend=std::max(std::max(prev,next),std::max(f.p[k].y,np.y));
+    ybegin=std::max(ybegin,0);
+    yend=std::min(yend,(int)t.rows.size());
+    f.p[k]=np;
+    if (ybegin>=yend)return;
+
+    EdgeRecord empty={INT_MAX,INT_MIN};
+    f.saved.assign(t.rows.begin()+ybegin,t.rows.begin()+yend);
+    std::fill(t.rows.begin()+ybegin,t.rows.begin()+yend,empty);
+    polygonToTableInteger(f.p.data(),n,t,ybegin,yend);
+
+    //the polygon rows may have shrunk, they are the rows between the highest and lowest vertex
+    int ymin=f.p[0].y,ymax=f.p[0].y;
+    for (int i=1;i<n;i++){
+        ymin=std::min(ymin,f.p[i].y);
+        ymax=std::max(ymax,f.p[i].y);
+    }
+    t.ymin=std::max(ymin,0);
+    t.ymax=std::min(ymax,(int)t.rows.size())-1;
+
+    for (int y=ybegin;y<yend;y++){
+        EdgeRecord o=f.saved[y-ybegin],c=t.rows[y];
+        //an empty span is taken as [0,0) so the differences below need no special case
+        if (o.xleft>=o.xright)o.xleft=o.xright=0;
+        if (c.xleft>=c.xright)c.xleft=c.xright=0;
+        FillSpan(fb,y,o.xleft,std::min(o.xright,c.xleft),f.background);
+        FillSpan(fb,y,std::max(o.xleft,c.xright),o.xright,f.background);
+        FillSpan(fb,y,c.xleft,std::min(c.xright,o.xleft),f.pixel);
+        FillSpan(fb,y,std::max(c.xleft,o.xright),c.xright,f.pixel);
+    }
+}
@@ -0,0 +1,150 @@
+#ifndef FILLINGANDSHADING_CONVEXFILL_H
+#define FILLINGANDSHADING_CONVEXFILL_H
+
+#include <windows.h>
+#include <climits>
+#include <vector>
+#include "Raster.h"
+
+/*
+* struct EdgeRecord
+* xleft: left x coordinate
+* xright: right x coordinate
+*/
+struct EdgeRecord {
+    int xleft,xright;
+};
+
+/*
+* struct Table
+* rows: one EdgeRecord per row of the target surface, rows outside the surface are clipped
+* ymin: first row touched by the polygon
+* ymax: last row touched by the polygon (ymax < ymin when the table is empty)
+* The table is meant to be reused between fills: InitTable only resets the rows the previous polygon
+* touched, and tableToScreen only walks [ymin, ymax], so a fill costs the polygon height and not the
+* surface height.
+*/
+struct Table {
+    std::vector<EdgeRecord> rows;
+    int ymin=0,ymax=-1;
+};
+
+/*
+* struct IncrementalFill
+* Description: State kept between the edits of a convex polygon filled with IncrementalFillBegin
+* t: table of the polygon as it is drawn now, rows outside [ymin, ymax] are empty
+* p: vertices of the polygon
+* saved: previous spans of the rows recomputed by the last move, kept to avoid allocating per move
+* pixel: fill pixel
+* background: pixel written where the polygon no longer covers
+*/
+struct IncrementalFill {
+    Table t;
+    std::vector<point> p;
+    std::vector<EdgeRecord> saved;
+    uint32_t pixel,background;
+};
+
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+
+/*
+* InitTable
+* Description: Initialize table for a surface of the given height, only the rows used by the previous
+*              polygon are reset unless the height changed
+* parameter: Table t, int height
+*/
+void InitTable(Table &t,int height);
+/*
+* Swap
+* Description: Swap two points
+* parameter: int x1, int y1, int x2, int y2
+*/
+void Swap(int &x1, int &y1, int &x2, int &y2);
+/*
+* EdgeToTable
+* Description: Take edge update table, rows outside the table are skipped
+* parameter: point p1, point p2, Table t
+*/
+void EdgeToTable(point p1,point p2,Table &t);
+/*
+* EdgeToTableInteger
+* Description: Take edge update table like EdgeToTable but walk the edge with integers only, x is kept as
+*              an integer part and a remainder over dy (Bresenham style) so ceil/floor are exact, there is no
+*              floating point error on tall edges and the xleft/xright values are the exact ones EdgeToTable
+*              approximates. Rows follow the same top-left rule: an edge covers [ytop, ybottom) and a row
+*              span is [ceil(xleft), floor(xright)).
+* parameter: point p1, point p2, Table t
+*/
+void EdgeToTableInteger(point p1,point p2,Table &t);
+/*
+* EdgeToTableInteger
+* Description: Take edge update only the rows [ybegin, yend) of the table with the integer edge walker,
+*              used when a table row range is owned by one worker or only some rows must be recomputed
+* parameter: point p1, point p2, Table t, int ybegin, int yend
+*/
+void EdgeToTableInteger(point p1,point p2,Table &t,int ybegin,int yend);
+/*
+* polygonToTable
+* Description: Take polygon update table
+* parameter: point p[], int n, Table t
+*/
+void polygonToTable(point p[],int n,Table &t);
+/*
+* polygonToTableInteger
+* Description: Take polygon update table with the integer edge walker
+* parameter: point p[], int n, Table t
+*/
+void polygonToTableInteger(point p[],int n,Table &t);
+/*
+* polygonToTableInteger
+* Description: Take polygon update only the rows [ybegin, yend) of the table with the integer edge walker
+* parameter: point p[], int n, Table t, int ybegin, int yend
+*/
+void polygonToTableInteger(const point p[],int n,Table &t,int ybegin,int yend);
+/*
+* tableToScreen
+* Description: Take table update screen, only the rows between ymin and ymax are visited
+* parameter: HDC hdc, Table t, COLORREF color
+*/
+void tableToScreen(HDC hdc,const Table &t,COLORREF color);
+/*
+* tableToScreen
+* Description: Take table write every row span into the framebuffer
+* parameter: Framebuffer fb, Table t, uint32_t pixel
+*/
+void tableToScreen(Framebuffer &fb,const Table &t,uint32_t pixel);
+/*
+* ConvexFill
+* Description: Fill convex polygon by initalize table and update it with polygon points then update screen,
+*              the table is sized to the clip box of the device context and built with the integer edge walker,
+*              it is thread_local so it is reused between calls and every thread fills with its own
+* parameter: HDC hdc, point p[], int n, COLORREF color
+*/
+void ConvexFill(HDC hdc,point p[],int n,COLORREF color);
+/*
+* ConvexFill
+* Description: Fill convex polygon into the framebuffer, with a thread_local table like the HDC version
+*              so it can be called from several threads (on different framebuffers or rows)
+* parameter: Framebuffer fb, point p[], int n, uint32_t pixel
+*/
+void ConvexFill(Framebuffer &fb,point p[],int n,uint32_t pixel);
+/*
+* IncrementalFillBegin
+* Description: Fill convex polygon into the framebuffer and keep its table and vertices for later moves
+* parameter: Framebuffer fb, IncrementalFill f, point p[], int n, uint32_t pixel, uint32_t background
+*/
+void IncrementalFillBegin(Framebuffer &fb,IncrementalFill &f,const point p[],int n,uint32_t pixel,uint32_t background);
+/*
+* IncrementalMoveVertex
+* Description: Move vertex k of the polygon and update the framebuffer. Only the rows spanned by the two
+*              edges touching the vertex before and after the move are recomputed (from all edges, with
+*              the row range integer walker), and in each of them only the pixels between the old and
+*              the new span ends are painted with the fill or background pixel. The result is the same
+*              as clearing the polygon and filling it again.
+* parameter: Framebuffer fb, IncrementalFill f, int k, point np
+*/
+void IncrementalMoveVertex(Framebuffer &fb,IncrementalFill &f,int k,point np);
+
+#endif //FILLINGANDSHADING_CONVEXFILL_H
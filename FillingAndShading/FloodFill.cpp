@@ -0,0 +1,245 @@
+#include "FloodFill.h"
+
+/*
+* PushRuns
+* Description: Push one seed for every run of fillable pixels of row y inside [xleft, xright]
+* parameter: Framebuffer fb, int y, int xleft, int xright, uint32_t bc, uint32_t fc, vector<point> s
+*/
+static void PushRuns(Framebuffer &fb,int y,int xleft,int xright,uint32_t bc,uint32_t fc,std::vector<point> &s){
+    if ((unsigned)y>=(unsigned)fb.height)return;
+    const uint32_t *row=fb.Row(y);
+    bool inRun=false;
+    for (int x=xleft;x<=xright;x++){
+        bool fillable= row[x]!=bc && row[x]!=fc;
+        if (fillable && !inRun)
+            s.push_back(point(x,y));
+        inRun=fillable;
+    }
+}
+
+/*
+* ScanlineFloodFill
+* Description: Fill the 4-connected region around (x,y) run by run and push one seed per run above and below
+* parameter: Framebuffer fb, int x, int y, uint32_t bc, uint32_t fc
+* return: number of filled pixels
+*/
+long long ScanlineFloodFill(Framebuffer &fb,int x,int y,uint32_t bc,uint32_t fc){
+    if ((unsigned)x>=(unsigned)fb.width || (unsigned)y>=(unsigned)fb.height)return 0;
+    long long filled=0;
+    std::vector<point> s;
+    s.push_back(point(x,y));
+    while (!s.empty()){
+        point p=s.back();
+        s.pop_back();
+        uint32_t *row=fb.Row(p.y);
+        //the run may have been filled from another seed since it was pushed
+        if (row[p.x]==bc || row[p.x]==fc)
+            continue;
+        int xleft=p.x,xright=p.x;
+        while (xleft>0 && row[xleft-1]!=bc && row[xleft-1]!=fc)xleft--;
+        while (xright<fb.width-1 && row[xright+1]!=bc && row[xright+1]!=fc)xright++;
+        std::fill(row+xleft,row+xright+1,fc);
+        filled+=xright-xleft+1;
+        PushRuns(fb,p.y-1,xleft,xright,bc,fc,s);
+        PushRuns(fb,p.y+1,xleft,xright,bc,fc,s);
+    }
+    return filled;
+}
+
+/*
+* SetRun
+* Description: Set the bits of the pixels [xleft, xright] of row y, a word at a time
+* parameter: int y, int xleft, int xright
+*/
+void RegionMask::SetRun(int y,int xleft,int xright){
+    size_t first=(size_t)y*width+xleft,last=(size_t)y*width+xright;
+    size_t wfirst=first>>6,wlast=last>>6;
+    uint64_t lo=~0ull<<(first&63),hi=~0ull>>(63-(last&63));
+    if (wfirst==wlast){
+        bits[wfirst]|=lo&hi;
+        return;
+    }
+    bits[wfirst]|=lo;
+    for (size_t i=wfirst+1;i<wlast;i++)bits[i]=~0ull;
+    bits[wlast]|=hi;
+}
+
+/*
+* RegionRuns
+* Description: Scan the region matching the seed color run by run, mark every run in the mask and fill it
+*              with fc when fc is given
+* parameter: Framebuffer fb, int x, int y, int tolerance, RegionMask mask, const uint32_t *fc
+* return: filled count and bounding box of the region
+*/
+static FillRegion RegionRuns(Framebuffer &fb,int x,int y,int tolerance,RegionMask &mask,const uint32_t *fc){
+    FillRegion region;
+    mask.Reset(fb.width,fb.height);
+    if ((unsigned)x>=(unsigned)fb.width || (unsigned)y>=(unsigned)fb.height)return region;
+    const uint32_t seed=fb.Row(y)[x];
+    std::vector<point> s;
+    s.push_back(point(x,y));
+    while (!s.empty()){
+        point p=s.back();
+        s.pop_back();
+        if (mask.Test(p.x,p.y))
+            continue;
+        uint32_t *row=fb.Row(p.y);
+        int xleft=p.x,xright=p.x;
+        while (xleft>0 && !mask.Test(xleft-1,p.y) && ColorMatch(row[xleft-1],seed,tolerance))xleft--;
+        while (xright<fb.width-1 && !mask.Test(xright+1,p.y) && ColorMatch(row[xright+1],seed,tolerance))xright++;
+        mask.SetRun(p.y,xleft,xright);
+        //written pixels are already marked, so the fill color never has to be told apart from the region
+        if (fc)
+            std::fill(row+xleft,row+xright+1,*fc);
+        region.filled+=xright-xleft+1;
+        region.xmin=std::min(region.xmin,xleft);
+        region.xmax=std::max(region.xmax,xright);
+        region.ymin=std::min(region.ymin,p.y);
+        region.ymax=std::max(region.ymax,p.y);
+        for (int ny=p.y-1;ny<=p.y+1;ny+=2){
+            if ((unsigned)ny>=(unsigned)fb.height)continue;
+            const uint32_t *nrow=fb.Row(ny);
+            bool inRun=false;
+            for (int nx=xleft;nx<=xright;nx++){
+                bool fillable=!mask.Test(nx,ny) && ColorMatch(nrow[nx],seed,tolerance);
+                if (fillable && !inRun)
+                    s.push_back(point(nx,ny));
+                inRun=fillable;
+            }
+        }
+    }
+    return region;
+}
+
+/*
+* SelectRegion
+* Description: Mark the region matching the color of (x,y) within tolerance in mask
+* parameter: const Framebuffer fb, int x, int y, int tolerance, RegionMask mask
+* return: filled count and bounding box of the region
+*/
+FillRegion SelectRegion(const Framebuffer &fb,int x,int y,int tolerance,RegionMask &mask){
+    //nothing is written when no fill color is given
+    return RegionRuns(const_cast<Framebuffer &>(fb),x,y,tolerance,mask,nullptr);
+}
+
+/*
+* ToleranceFloodFill
+* Description: Fill the region matching the color of (x,y) within tolerance with fc
+* parameter: Framebuffer fb, int x, int y, uint32_t fc, int tolerance
+* return: filled count and bounding box of the region
+*/
+FillRegion ToleranceFloodFill(Framebuffer &fb,int x,int y,uint32_t fc,int tolerance){
+    RegionMask mask;
+    return RegionRuns(fb,x,y,tolerance,mask,&fc);
+}
+
+/*
+* Reserve
+* Description: Size the seed stack and the pending bits, nothing is allocated when they are already big enough.
+*              The pending bits are not cleared: they are zero when allocated and a fill leaves none set,
+*              so a small fill costs nothing proportional to the framebuffer size.
+* parameter: int capacity, int width, int height
+*/
+void SeedArena::Reserve(int capacity,int width,int height){
+    this->capacity=std::max(capacity,1);
+    if ((int)seeds.size()<this->capacity){
+        seeds.resize(this->capacity);
+        allocations++;
+    }
+    size_t words=((size_t)width*height+63)/64;
+    if (pending.size()<words){
+        pending.resize(words);
+        allocations++;
+    }
+    this->width=width;
+    this->height=height;
+    firstPending=endPending=0;
+    top=0;
+}
+
+/*
+* PushSeed
+* Description: Push a seed on the arena stack, or mark it pending when the stack is full
+* parameter: SeedArena arena, int x, int y
+*/
+static inline void PushSeed(SeedArena &arena,int x,int y){
+    if (arena.top<arena.capacity){
+        arena.seeds[arena.top++]=point(x,y);
+        arena.peak=std::max(arena.peak,arena.top);
+        return;
+    }
+    size_t i=(size_t)y*arena.width+x;
+    arena.pending[i>>6]|=1ull<<(i&63);
+    if (arena.firstPending>=arena.endPending){
+        arena.firstPending=i>>6;
+        arena.endPending=(i>>6)+1;
+    }else{
+        arena.firstPending=std::min(arena.firstPending,i>>6);
+        arena.endPending=std::max(arena.endPending,(i>>6)+1);
+    }
+    arena.overflows++;
+}
+
+/*
+* PushBoundedRuns
+* Description: Push one seed for every run of fillable pixels of row y inside [xleft, xright] on the arena
+* parameter: Framebuffer fb, int y, int xleft, int xright, uint32_t bc, uint32_t fc, SeedArena arena
+*/
+static void PushBoundedRuns(Framebuffer &fb,int y,int xleft,int xright,uint32_t bc,uint32_t fc,SeedArena &arena){
+    if ((unsigned)y>=(unsigned)fb.height)return;
+    const uint32_t *row=fb.Row(y);
+    bool inRun=false;
+    for (int x=xleft;x<=xright;x++){
+        bool fillable= row[x]!=bc && row[x]!=fc;
+        if (fillable && !inRun)
+            PushSeed(arena,x,y);
+        inRun=fillable;
+    }
+}
+
+/*
+* BoundedFloodFill
+* Description: Fill the region around (x,y) run by run with a bounded seed stack and pending bits for overflow
+* parameter: Framebuffer fb, int x, int y, uint32_t bc, uint32_t fc, SeedArena arena
+* return: number of filled pixels
+*/
+long long BoundedFloodFill(Framebuffer &fb,int x,int y,uint32_t bc,uint32_t fc,SeedArena &arena){
+    if ((unsigned)x>=(unsigned)fb.width || (unsigned)y>=(unsigned)fb.height)return 0;
+    arena.Reserve(arena.capacity,fb.width,fb.height);
+    long long filled=0;
+    PushSeed(arena,x,y);
+    for (;;){
+        while (arena.top>0){
+            point p=arena.seeds[--arena.top];
+            uint32_t *row=fb.Row(p.y);
+            //the run may have been filled from another seed since it was pushed
+            if (row[p.x]==bc || row[p.x]==fc)
+                continue;
+            int xleft=p.x,xright=p.x;
+            while (xleft>0 && row[xleft-1]!=bc && row[xleft-1]!=fc)xleft--;
+            while (xright<fb.width-1 && row[xright+1]!=bc && row[xright+1]!=fc)xright++;
+            std::fill(row+xleft,row+xright+1,fc);
+            filled+=xright-xleft+1;
+            PushBoundedRuns(fb,p.y-1,xleft,xright,bc,fc,arena);
+            PushBoundedRuns(fb,p.y+1,xleft,xright,bc,fc,arena);
+        }
+        //move pending seeds back to the stack until it is full again, only the words that had bits set are read
+        bool found=false;
+        size_t w=arena.firstPending;
+        for (;w<arena.endPending && arena.top<arena.capacity;w++){
+            while (arena.pending[w] && arena.top<arena.capacity){
+                int bit=0;
+                while (!((arena.pending[w]>>bit)&1))bit++;
+                arena.pending[w]&=arena.pending[w]-1;
+                size_t i=w*64+bit;
+                arena.seeds[arena.top++]=point((int)(i%fb.width),(int)(i/fb.width));
+                found=true;
+            }
+            if (arena.pending[w])break;
+        }
+        arena.firstPending=w;
+        if (!found)break;
+        arena.rescans++;
+    }
+    return filled;
+}
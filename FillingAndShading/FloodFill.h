@@ -0,0 +1,123 @@
+#ifndef FILLINGANDSHADING_FLOODFILL_H
+#define FILLINGANDSHADING_FLOODFILL_H
+
+#include <climits>
+#include <stdlib.h>
+#include "Raster.h"
+
+/*
+* struct RegionMask
+* Description: One bit per framebuffer pixel marking the pixels a fill already visited, so matching never
+*              depends on re-reading a pixel that was just written
+* width, height: size of the masked framebuffer
+* bits: row by row bits, pixel (x,y) is bit y*width+x
+*/
+struct RegionMask {
+    int width=0,height=0;
+    std::vector<uint64_t> bits;
+    void Reset(int w,int h){
+        width=w;
+        height=h;
+        bits.assign(((size_t)w*h+63)/64,0);
+    }
+    bool Test(int x,int y) const {
+        size_t i=(size_t)y*width+x;
+        return (bits[i>>6]>>(i&63))&1;
+    }
+    void SetRun(int y,int xleft,int xright);
+};
+
+/*
+* struct FillRegion
+* Description: Result of a tolerance fill or selection
+* filled: number of pixels in the region
+* xmin, ymin, xmax, ymax: inclusive bounding box of the region, xmin>xmax when nothing was filled
+*/
+struct FillRegion {
+    long long filled=0;
+    int xmin=INT_MAX,ymin=INT_MAX,xmax=INT_MIN,ymax=INT_MIN;
+};
+
+/*
+* struct SeedArena
+* Description: Preallocated storage of BoundedFloodFill that can be reused between fills, so a fill never
+*              allocates once the arena has been reserved for the framebuffer size
+* capacity: maximum number of seeds on the stack
+* seeds, top: the seed stack, seeds has capacity entries and top of them are in use
+* width, height, pending: one bit per pixel for the seeds that did not fit on the stack, every fill drains
+*                         them so they are all clear between fills and never have to be cleared
+* firstPending, endPending: pending bits are only set in the words [firstPending, endPending)
+* allocations: times the storage had to grow
+* overflows: seeds moved to the pending bits because the stack was full
+* rescans: passes over the pending bits to put them back on the stack
+* peak: deepest stack seen
+*/
+struct SeedArena {
+    int capacity=4096;
+    std::vector<point> seeds;
+    int top=0;
+    int width=0,height=0;
+    std::vector<uint64_t> pending;
+    size_t firstPending=0,endPending=0;
+    long long allocations=0,overflows=0,rescans=0;
+    int peak=0;
+    void Reserve(int capacity,int width,int height);
+};
+
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+
+/*
+* ScanlineFloodFill
+* Description: Fill the 4-connected region around (x,y) in the framebuffer like myFloodFill (every pixel that
+*              is neither the boundary color nor the fill color is filled) but run by run: a seed is
+*              extended left and right to the whole run, the run is filled with one span write, and only
+*              one seed per fillable run in the rows above and below is pushed. Every pixel is tested a
+*              constant number of times and the stack holds runs instead of pixels.
+* parameter: Framebuffer fb, int x, int y, uint32_t bc, uint32_t fc
+* return: number of filled pixels
+*/
+long long ScanlineFloodFill(Framebuffer &fb,int x,int y,uint32_t bc,uint32_t fc);
+/*
+* ColorMatch
+* Description: True when every channel of the two pixels differs by at most tolerance, alpha is ignored
+* parameter: uint32_t a, uint32_t b, int tolerance
+*/
+inline bool ColorMatch(uint32_t a,uint32_t b,int tolerance){
+    int dr=(int)((a>>16)&0xFF)-(int)((b>>16)&0xFF);
+    int dg=(int)((a>>8)&0xFF)-(int)((b>>8)&0xFF);
+    int db=(int)(a&0xFF)-(int)(b&0xFF);
+    return abs(dr)<=tolerance && abs(dg)<=tolerance && abs(db)<=tolerance;
+}
+/*
+* SelectRegion
+* Description: Mark the 4-connected region of pixels matching the color of (x,y) within tolerance in mask,
+*              without changing the framebuffer. Runs the same run-by-run scan as ScanlineFloodFill but
+*              visited pixels are tracked in the mask, so the region may contain any color.
+* parameter: const Framebuffer fb, int x, int y, int tolerance, RegionMask mask
+* return: filled count and bounding box of the region
+*/
+FillRegion SelectRegion(const Framebuffer &fb,int x,int y,int tolerance,RegionMask &mask);
+/*
+* ToleranceFloodFill
+* Description: Fill the 4-connected region of pixels matching the color of (x,y) within tolerance with fc.
+*              Unlike myFloodFill there is no boundary color: the region ends where the color stops
+*              matching, and since visited pixels come from a bitset fc may itself match the seed color.
+* parameter: Framebuffer fb, int x, int y, uint32_t fc, int tolerance
+* return: filled count and bounding box of the region
+*/
+FillRegion ToleranceFloodFill(Framebuffer &fb,int x,int y,uint32_t fc,int tolerance);
+
+/*
+* BoundedFloodFill
+* Description: Fill the same region as ScanlineFloodFill with a seed stack of at most arena.capacity entries
+*              and no allocation during the fill. When the stack is full a seed is not lost but its pixel
+*              is marked in the pending bits of the arena, and once the stack is empty the pending pixels
+*              that are still fillable are pushed again, so a small capacity only costs extra passes.
+* parameter: Framebuffer fb, int x, int y, uint32_t bc, uint32_t fc, SeedArena arena
+* return: number of filled pixels
+*/
+long long BoundedFloodFill(Framebuffer &fb,int x,int y,uint32_t bc,uint32_t fc,SeedArena &arena);
+
+#endif //FILLINGANDSHADING_FLOODFILL_H
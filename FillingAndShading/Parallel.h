@@ -0,0 +1,43 @@
+#ifndef FILLINGANDSHADING_PARALLEL_H
+#define FILLINGANDSHADING_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+
+/*
+* ParallelFor
+* Description: Run fn(i) for every i in [0, count) on a pool of workers, each worker takes the next i until
+*              none is left so uneven items balance out. threads <= 0 means one per hardware thread, it is
+*              clamped to [1, count] and the calling thread is one of the workers. Per worker scratch can
+*              be thread_local in fn.
+* parameter: int count, int threads, F fn
+* return: number of workers used
+*/
+template<typename F>
+int ParallelFor(int count,int threads,F fn){
+    if (count<=0)return 0;
+    if (threads<=0)
+        threads=(int)std::thread::hardware_concurrency();
+    threads=std::max(1,std::min(threads,count));
+
+    std::atomic<int> next(0);
+    auto worker=[&](){
+        for (int i=next++;i<count;i=next++)
+            fn(i);
+    };
+    std::vector<std::thread> pool;
+    for (int i=1;i<threads;i++)
+        pool.emplace_back(worker);
+    worker();
+    for (std::thread &th : pool)
+        th.join();
+    return threads;
+}
+
+#endif //FILLINGANDSHADING_PARALLEL_H
@@ -0,0 +1,141 @@
+#include "PatternFill.h"
+#include <math.h>
+
+/*
+* Wrap
+* Description: a mod n in [0, n) for negative a as well
+* parameter: long long a, long long n
+*/
+static inline long long Wrap(long long a,long long n){
+    a%=n;
+    return a<0 ? a+n : a;
+}
+
+/*
+* ClipSpan
+* Description: Clip the span of table row y to the framebuffer, returns false when nothing is left
+* parameter: Framebuffer fb, Table t, int y, int xleft, int xright
+*/
+static inline bool ClipSpan(const Framebuffer &fb,const Table &t,int y,int &xleft,int &xright){
+    if ((unsigned)y>=(unsigned)fb.height)return false;
+    xleft=std::max(t.rows[y].xleft,0);
+    xright=std::min(t.rows[y].xright,fb.width);
+    return xleft<xright;
+}
+
+/*
+* HatchPattern
+* Description: Return the 8x8 pattern of a hatch style
+* parameter: HatchStyle style
+*/
+Pattern8x8 HatchPattern(HatchStyle style){
+    Pattern8x8 p;
+    for (int y=0;y<8;y++){
+        uint8_t fdiag=(uint8_t)(0x80>>y),bdiag=(uint8_t)(0x01<<y);
+        switch (style){
+            case HATCH_HORIZONTAL: p.rows[y]= y==4 ? 0xFF : 0x00; break;
+            case HATCH_VERTICAL: p.rows[y]=0x08; break;
+            case HATCH_FDIAGONAL: p.rows[y]=fdiag; break;
+            case HATCH_BDIAGONAL: p.rows[y]=bdiag; break;
+            case HATCH_CROSS: p.rows[y]= y==4 ? 0xFF : 0x08; break;
+            default: p.rows[y]=fdiag|bdiag; break;
+        }
+    }
+    return p;
+}
+
+/*
+* TextureMappingFromTriangle
+* Description: Solve the affine map taking the three screen points to the three texture coordinates
+* parameter: point p[3], double u[3], double v[3], TextureMapping m
+*/
+bool TextureMappingFromTriangle(const point p[3],const double u[3],const double v[3],TextureMapping &m){
+    double x1=p[1].x-p[0].x,y1=p[1].y-p[0].y;
+    double x2=p[2].x-p[0].x,y2=p[2].y-p[0].y;
+    double det=x1*y2-x2*y1;
+    if (det==0)return false;
+    double u1=u[1]-u[0],u2=u[2]-u[0];
+    double v1=v[1]-v[0],v2=v[2]-v[0];
+    m.dudx=(u1*y2-u2*y1)/det;
+    m.dudy=(u2*x1-u1*x2)/det;
+    m.dvdx=(v1*y2-v2*y1)/det;
+    m.dvdy=(v2*x1-v1*x2)/det;
+    m.u0=u[0]-m.dudx*p[0].x-m.dudy*p[0].y;
+    m.v0=v[0]-m.dvdx*p[0].x-m.dvdy*p[0].y;
+    return true;
+}
+
+/*
+* tableToScreenPattern
+* Description: Take table write every row span with an 8x8 pattern expanded once per row
+* parameter: Framebuffer fb, Table t, Pattern8x8 pattern, uint32_t fg, uint32_t bg, bool transparent
+*/
+void tableToScreenPattern(Framebuffer &fb,const Table &t,const Pattern8x8 &pattern,uint32_t fg,uint32_t bg,bool transparent){
+    for (int i=t.ymin;i<=t.ymax;i++){
+        int xleft,xright;
+        if (!ClipSpan(fb,t,i,xleft,xright))continue;
+        uint8_t bits=pattern.rows[i&7];
+        uint32_t *row=fb.Row(i);
+        if (transparent){
+            for (int x=xleft;x<xright;x++)
+                if (bits&(0x80>>(x&7)))row[x]=fg;
+            continue;
+        }
+        uint32_t line[8];
+        for (int k=0;k<8;k++)
+            line[k]=(bits&(0x80>>k)) ? fg : bg;
+        //head up to the next multiple of 8, then whole copies of the expanded row
+        int x=xleft;
+        for (;x<xright && (x&7);x++)row[x]=line[x&7];
+        for (;x+8<=xright;x+=8)std::copy(line,line+8,row+x);
+        for (;x<xright;x++)row[x]=line[x&7];
+    }
+}
+
+/*
+* tableToScreenTiled
+* Description: Take table write every row span from a bitmap repeated from (ox,oy), copied in contiguous pieces
+* parameter: Framebuffer fb, Table t, Framebuffer tile, int ox, int oy
+*/
+void tableToScreenTiled(Framebuffer &fb,const Table &t,const Framebuffer &tile,int ox,int oy){
+    if (tile.width<=0 || tile.height<=0)return;
+    for (int i=t.ymin;i<=t.ymax;i++){
+        int xleft,xright;
+        if (!ClipSpan(fb,t,i,xleft,xright))continue;
+        const uint32_t *src=tile.Row((int)Wrap((long long)i-oy,tile.height));
+        uint32_t *row=fb.Row(i);
+        int u=(int)Wrap((long long)xleft-ox,tile.width);
+        for (int x=xleft;x<xright;){
+            int count=std::min(xright-x,tile.width-u);
+            std::copy(src+u,src+u+count,row+x);
+            x+=count;
+            u=0;
+        }
+    }
+}
+
+/*
+* tableToScreenTexture
+* Description: Take table write every row span from an affine mapped texture with incremental u,v in 16.16
+* parameter: Framebuffer fb, Table t, Framebuffer texture, TextureMapping m
+*/
+void tableToScreenTexture(Framebuffer &fb,const Table &t,const Framebuffer &texture,const TextureMapping &m){
+    if (texture.width<=0 || texture.height<=0)return;
+    //texture size and steps in 16.16, the steps are reduced into [0, size) so wrapping is one subtraction
+    long long uSize=(long long)texture.width<<16,vSize=(long long)texture.height<<16;
+    long long du=Wrap(llround(m.dudx*65536),uSize),dv=Wrap(llround(m.dvdx*65536),vSize);
+    for (int i=t.ymin;i<=t.ymax;i++){
+        int xleft,xright;
+        if (!ClipSpan(fb,t,i,xleft,xright))continue;
+        long long u=Wrap(llround((m.u0+m.dudx*xleft+m.dudy*i)*65536),uSize);
+        long long v=Wrap(llround((m.v0+m.dvdx*xleft+m.dvdy*i)*65536),vSize);
+        uint32_t *row=fb.Row(i);
+        for (int x=xleft;x<xright;x++){
+            row[x]=texture.Row((int)(v>>16))[u>>16];
+            u+=du;
+            if (u>=uSize)u-=uSize;
+            v+=dv;
+            if (v>=vSize)v-=vSize;
+        }
+    }
+}
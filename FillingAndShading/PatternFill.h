@@ -0,0 +1,84 @@
+#ifndef FILLINGANDSHADING_PATTERNFILL_H
+#define FILLINGANDSHADING_PATTERNFILL_H
+
+#include <stdint.h>
+#include "Raster.h"
+#include "ConvexFill.h"
+
+/*
+* struct Pattern8x8
+* Description: 8x8 bit pattern like a GDI pattern brush, bit 7 of rows[y] is the leftmost pixel. The
+*              pattern is anchored at the framebuffer origin so neighbouring fills line up.
+* rows: one byte per pattern row, a set bit takes the foreground pixel
+*/
+struct Pattern8x8 {
+    uint8_t rows[8];
+};
+
+/*
+* enum HatchStyle
+* Description: the usual hatch patterns, see HatchPattern
+*/
+enum HatchStyle {
+    HATCH_HORIZONTAL,
+    HATCH_VERTICAL,
+    HATCH_FDIAGONAL,
+    HATCH_BDIAGONAL,
+    HATCH_CROSS,
+    HATCH_DIAGCROSS
+};
+
+/*
+* struct TextureMapping
+* Description: affine map from a framebuffer pixel (x,y) to texel (u,v):
+*              u = u0 + dudx*x + dudy*y, v = v0 + dvdx*x + dvdy*y, the texture wraps around in u and v
+*/
+struct TextureMapping {
+    double u0,v0;
+    double dudx,dvdx;
+    double dudy,dvdy;
+};
+
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+
+/*
+* HatchPattern
+* Description: Return the 8x8 pattern of a hatch style
+* parameter: HatchStyle style
+*/
+Pattern8x8 HatchPattern(HatchStyle style);
+/*
+* TextureMappingFromTriangle
+* Description: Build the affine map that takes the three screen points to the three texture coordinates,
+*              returns false when the points are collinear
+* parameter: point p[3], double u[3], double v[3], TextureMapping m
+*/
+bool TextureMappingFromTriangle(const point p[3],const double u[3],const double v[3],TextureMapping &m);
+/*
+* tableToScreenPattern
+* Description: Take table write every row span with an 8x8 pattern. The pattern row is expanded once per
+*              row to 8 pixels and the span is written from that. If transparent is set the background
+*              pixels are left unchanged.
+* parameter: Framebuffer fb, Table t, Pattern8x8 pattern, uint32_t fg, uint32_t bg, bool transparent
+*/
+void tableToScreenPattern(Framebuffer &fb,const Table &t,const Pattern8x8 &pattern,uint32_t fg,uint32_t bg,bool transparent = false);
+/*
+* tableToScreenTiled
+* Description: Take table write every row span from a bitmap repeated over the framebuffer with its top left
+*              corner at (ox,oy). Each span is copied as contiguous pieces of the bitmap row and wraps
+*              around to the start of the row at its right edge.
+* parameter: Framebuffer fb, Table t, Framebuffer tile, int ox, int oy
+*/
+void tableToScreenTiled(Framebuffer &fb,const Table &t,const Framebuffer &tile,int ox,int oy);
+/*
+* tableToScreenTexture
+* Description: Take table write every row span from an affine mapped texture. u,v are computed once at the
+*              start of the span and stepped by dudx,dvdx in 16.16 fixed point with the steps reduced
+*              into the texture size, so a pixel costs two additions and two compares to wrap.
+* parameter: Framebuffer fb, Table t, Framebuffer texture, TextureMapping m
+*/
+void tableToScreenTexture(Framebuffer &fb,const Table &t,const Framebuffer &texture,const TextureMapping &m);
+
+#endif //FILLINGANDSHADING_PATTERNFILL_H
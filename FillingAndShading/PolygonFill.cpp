@@ -0,0 +1,96 @@
+#include "PolygonFill.h"
+#include <math.h>
+
+/*
+* BuildEdgeTable
+* Description: Take polygon build the edge table, every non horizontal edge sorted by its first row
+* parameter: point p[], int n, vector<Edge> et
+*/
+void BuildEdgeTable(point p[],int n,std::vector<Edge> &et){
+    et.clear();
+    //start with last point
+    point v1=p[n-1];
+    for (int i=0;i<n;i++){
+        point v2=p[i];
+        //horizontal edges never cross a row
+        if (v1.y!=v2.y){
+            Edge e;
+            point top=v1,bottom=v2;
+            e.winding=1;
+            if (top.y>bottom.y){
+                std::swap(top,bottom);
+                e.winding=-1;
+            }
+            e.ymin=top.y;
+            e.ymax=bottom.y;
+            e.mi=(double)(bottom.x-top.x)/(bottom.y-top.y);
+            e.x=top.x;
+            et.push_back(e);
+        }
+        v1=v2;
+    }
+    std::sort(et.begin(),et.end(),[](const Edge &a,const Edge &b){ return a.ymin<b.ymin; });
+}
+
+/*
+* GeneralPolygonFill
+* Description: Fill any polygon (convex, concave or self intersecting) with a sorted edge table and an
+*              active edge list, for every row the active edges are sorted by x and the spans between
+*              them that are inside by the fill rule are written into the framebuffer.
+* parameter: Framebuffer fb, point p[], int n, uint32_t pixel, FillRule rule
+*/
+void GeneralPolygonFill(Framebuffer &fb,point p[],int n,uint32_t pixel,FillRule rule){
+    if (n<3)return;
+    std::vector<Edge> et;
+    BuildEdgeTable(p,n,et);
+    if (et.empty())return;
+
+    std::vector<Edge> active;
+    size_t next=0;
+    int y=std::max(et.front().ymin,0);
+    while (y<fb.height && (next<et.size() || !active.empty())){
+        //move the edges that start at or above this row to the active list
+        while (next<et.size() && et[next].ymin<=y){
+            Edge e=et[next++];
+            if (e.ymax>y){
+                e.x+=(y-e.ymin)*e.mi;
+                active.push_back(e);
+            }
+        }
+        if (active.empty()){
+            //jump over the gap between two parts of the polygon
+            if (next<et.size())y=std::max(y+1,et[next].ymin);
+            else break;
+            continue;
+        }
+        //the list stays almost sorted between rows so insertion sort is linear in practice
+        for (size_t i=1;i<active.size();i++){
+            Edge e=active[i];
+            size_t j=i;
+            while (j>0 && active[j-1].x>e.x){
+                active[j]=active[j-1];
+                j--;
+            }
+            active[j]=e;
+        }
+        //walk the crossings from left to right emitting the inside spans
+        int winding=0;
+        for (size_t i=0;i+1<active.size();i++){
+            winding+= rule==FILL_EVEN_ODD ? 1 : active[i].winding;
+            bool inside= rule==FILL_EVEN_ODD ? (winding&1)!=0 : winding!=0;
+            if (inside)
+                FillSpan(fb,y,(int)ceil(active[i].x),(int)ceil(active[i+1].x),pixel);
+        }
+        //step to the next row, dropping the edges that end here
+        y++;
+        size_t kept=0;
+        for (size_t i=0;i<active.size();i++){
+            if (active[i].ymax>y){
+                active[kept]=active[i];
+                active[kept].x+=active[kept].mi;
+                kept++;
+            }
+        }
+        active.resize(kept);
+    }
+}
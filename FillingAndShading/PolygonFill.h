@@ -0,0 +1,51 @@
+#ifndef FILLINGANDSHADING_POLYGONFILL_H
+#define FILLINGANDSHADING_POLYGONFILL_H
+
+#include "Raster.h"
+
+/*
+* enum FillRule
+* FILL_EVEN_ODD: a pixel is inside when a ray from it crosses the outline an odd number of times
+* FILL_NON_ZERO: a pixel is inside when the outline winds around it a non zero number of times
+*/
+enum FillRule {
+    FILL_EVEN_ODD,
+    FILL_NON_ZERO
+};
+
+/*
+* struct Edge
+* ymin: first row the edge covers
+* ymax: row after the last row the edge covers
+* x: x of the edge at the current row
+* mi: inverse slope, added to x for every row
+* winding: +1 if the edge goes down in the polygon order, -1 if it goes up
+*/
+struct Edge {
+    int ymin,ymax;
+    double x,mi;
+    int winding;
+};
+
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+
+/*
+* BuildEdgeTable
+* Description: Take polygon build the edge table, every non horizontal edge sorted by its first row
+* parameter: point p[], int n, vector<Edge> et
+*/
+void BuildEdgeTable(point p[],int n,std::vector<Edge> &et);
+/*
+* GeneralPolygonFill
+* Description: Fill any polygon (convex, concave or self intersecting) with a sorted edge table and an
+*              active edge list, for every row the active edges are sorted by x and the spans between
+*              them that are inside by the fill rule are written into the framebuffer.
+*              Rows are sampled like ConvexFill: an edge covers rows [ymin, ymax) and a span covers
+*              [ceil(xleft), ceil(xright)) so polygons sharing an edge do not overlap.
+* parameter: Framebuffer fb, point p[], int n, uint32_t pixel, FillRule rule
+*/
+void GeneralPolygonFill(Framebuffer &fb,point p[],int n,uint32_t pixel,FillRule rule);
+
+#endif //FILLINGANDSHADING_POLYGONFILL_H
@@ -0,0 +1,119 @@
+#ifndef FILLINGANDSHADING_RASTER_H
+#define FILLINGANDSHADING_RASTER_H
+
+#include <windows.h>
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+
+/*
+* struct point
+* x: x coordinate
+* y: y coordinate
+*/
+struct point {
+    int x,y;
+    point(int x = 0, int y = 0) : x(x), y(y) {}
+};
+
+/*
+* struct Framebuffer
+* Description: In-memory drawing surface the fill algorithms write spans into instead of calling SetPixel
+*              per pixel. Pixels are packed 32-bit 0xAARRGGBB (the layout of a 32bpp DIB) stored row by row,
+*              so the whole buffer can be shown in a window with Present.
+* width: number of columns
+* height: number of rows
+* pixels: width*height packed pixels, pixel (x,y) is at pixels[y*width+x]
+*/
+struct Framebuffer {
+    int width,height;
+    std::vector<uint32_t> pixels;
+    Framebuffer(int width = 0, int height = 0, uint32_t background = 0xFFFFFFFF)
+        : width(width), height(height), pixels((size_t)width * height, background) {}
+    uint32_t *Row(int y) { return &pixels[(size_t)y * width]; }
+    const uint32_t *Row(int y) const { return &pixels[(size_t)y * width]; }
+};
+
+/*
+* PackColor
+* Description: Convert a GDI COLORREF (0x00BBGGRR) to an opaque packed framebuffer pixel (0xAARRGGBB)
+* parameter: COLORREF color
+*/
+inline uint32_t PackColor(COLORREF color){
+    return 0xFF000000u | ((uint32_t)GetRValue(color) << 16) | ((uint32_t)GetGValue(color) << 8) | GetBValue(color);
+}
+
+/*
+* UnpackColor
+* Description: Convert a packed framebuffer pixel back to a GDI COLORREF, alpha is dropped
+* parameter: uint32_t pixel
+*/
+inline COLORREF UnpackColor(uint32_t pixel){
+    return RGB((pixel >> 16) & 0xFF, (pixel >> 8) & 0xFF, pixel & 0xFF);
+}
+
+/*
+* Clear
+* Description: Set every pixel of the framebuffer to the given packed pixel
+* parameter: Framebuffer fb, uint32_t pixel
+*/
+inline void Clear(Framebuffer &fb, uint32_t pixel){
+    std::fill(fb.pixels.begin(), fb.pixels.end(), pixel);
+}
+
+/*
+* FillSpan
+* Description: Write pixel to the half open span [xleft, xright) of row y, clipped to the framebuffer
+* parameter: Framebuffer fb, int y, int xleft, int xright, uint32_t pixel
+*/
+inline void FillSpan(Framebuffer &fb, int y, int xleft, int xright, uint32_t pixel){
+    if ((unsigned)y >= (unsigned)fb.height)
+        return;
+    if (xleft < 0)
+        xleft = 0;
+    if (xright > fb.width)
+        xright = fb.width;
+    if (xleft < xright)
+        std::fill(fb.Row(y) + xleft, fb.Row(y) + xright, pixel);
+}
+
+/*
+* SetPixel
+* Description: Same contract as the GDI SetPixel for a framebuffer, pixels outside are ignored
+* parameter: Framebuffer fb, int x, int y, COLORREF color
+*/
+inline COLORREF SetPixel(Framebuffer &fb, int x, int y, COLORREF color){
+    if ((unsigned)x >= (unsigned)fb.width || (unsigned)y >= (unsigned)fb.height)
+        return CLR_INVALID;
+    fb.Row(y)[x] = PackColor(color);
+    return color;
+}
+
+/*
+* GetPixel
+* Description: Same contract as the GDI GetPixel for a framebuffer, CLR_INVALID outside
+* parameter: Framebuffer fb, int x, int y
+*/
+inline COLORREF GetPixel(const Framebuffer &fb, int x, int y){
+    if ((unsigned)x >= (unsigned)fb.width || (unsigned)y >= (unsigned)fb.height)
+        return CLR_INVALID;
+    return UnpackColor(fb.Row(y)[x]);
+}
+
+/*
+* Present
+* Description: Copy the framebuffer to the device context with its top left corner at (x,y)
+* parameter: HDC hdc, Framebuffer fb, int x, int y
+*/
+inline void Present(HDC hdc, const Framebuffer &fb, int x, int y){
+    BITMAPINFO bmi = {};
+    bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    bmi.bmiHeader.biWidth = fb.width;
+    bmi.bmiHeader.biHeight = -fb.height; // top-down rows
+    bmi.bmiHeader.biPlanes = 1;
+    bmi.bmiHeader.biBitCount = 32;
+    bmi.bmiHeader.biCompression = BI_RGB;
+    SetDIBitsToDevice(hdc, x, y, fb.width, fb.height, 0, 0, 0, fb.height, fb.pixels.data(), &bmi, DIB_RGB_COLORS);
+}
+
+#endif //FILLINGANDSHADING_RASTER_H
@@ -0,0 +1,203 @@
+#include "RegionLabeling.h"
+#include "Parallel.h"
+
+/*
+* struct LabelRun
+* Description: run [xleft, xright] of region pixels on row y
+*/
+struct LabelRun {
+    int y,xleft,xright;
+};
+
+/*
+* struct LabelStrip
+* runs: runs of the strip row by row, left to right
+* parent: union-find parent of every run, a local index while the strip is labeled
+* offset: index of the first run of the strip among the runs of all strips
+* firstEnd: end of the runs of the first row
+* lastBegin: begin of the runs of the last row
+*/
+struct LabelStrip {
+    std::vector<LabelRun> runs;
+    std::vector<int> parent;
+    int offset=0,firstEnd=0,lastBegin=0;
+};
+
+/*
+* Find
+* Description: Root of a run with path halving, the root of a set is always its smallest run index
+* parameter: int parent[], int i
+*/
+static int Find(int parent[],int i){
+    while (parent[i]!=i){
+        parent[i]=parent[parent[i]];
+        i=parent[i];
+    }
+    return i;
+}
+
+/*
+* Union
+* Description: Join the sets of two runs under the smaller root
+* parameter: int parent[], int a, int b
+*/
+static void Union(int parent[],int a,int b){
+    a=Find(parent,a);
+    b=Find(parent,b);
+    if (a<b)parent[b]=a;
+    else if (b<a)parent[a]=b;
+}
+
+/*
+* JoinRows
+* Description: Union every run of a row with the runs of the next row it overlaps, both rows sorted by x.
+*              The runs are numbered aoffset+i and boffset+j in parent.
+* parameter: LabelRun a[], int an, int aoffset, LabelRun b[], int bn, int boffset, int parent[]
+*/
+static void JoinRows(const LabelRun a[],int an,int aoffset,const LabelRun b[],int bn,int boffset,int parent[]){
+    int i=0,j=0;
+    while (i<an && j<bn){
+        if (a[i].xright<b[j].xleft)i++;
+        else if (b[j].xright<a[i].xleft)j++;
+        else{
+            Union(parent,aoffset+i,boffset+j);
+            if (a[i].xright<b[j].xright)i++;
+            else j++;
+        }
+    }
+}
+
+/*
+* BuildRegions
+* Description: Cut the framebuffer into runs of region pixels and join the runs of every region in one
+*              union-find. On return parent holds the root of every run, indexed by strip offset + run index.
+* parameter: const Framebuffer fb, uint32_t bc, uint32_t fc, int threads, vector<LabelStrip> strips, vector<int> parent
+* return: number of workers used
+*/
+static int BuildRegions(const Framebuffer &fb,uint32_t bc,uint32_t fc,int threads,std::vector<LabelStrip> &strips,std::vector<int> &parent){
+    int count=(fb.height+LABEL_STRIP_ROWS-1)/LABEL_STRIP_ROWS;
+    strips.assign(count,LabelStrip());
+
+    //label every strip on its own with local run indices
+    threads=ParallelFor(count,threads,[&](int s){
+        LabelStrip &strip=strips[s];
+        int ybegin=s*LABEL_STRIP_ROWS,yend=std::min(ybegin+LABEL_STRIP_ROWS,fb.height);
+        int prevBegin=0,prevEnd=0;
+        for (int y=ybegin;y<yend;y++){
+            const uint32_t *row=fb.Row(y);
+            int curBegin=(int)strip.runs.size();
+            for (int x=0;x<fb.width;){
+                if (row[x]==bc || row[x]==fc){
+                    x++;
+                    continue;
+                }
+                int xleft=x;
+                while (x<fb.width && row[x]!=bc && row[x]!=fc)x++;
+                strip.parent.push_back((int)strip.runs.size());
+                strip.runs.push_back({y,xleft,x-1});
+            }
+            int curEnd=(int)strip.runs.size();
+            if (y==ybegin)strip.firstEnd=curEnd;
+            const LabelRun *runs=strip.runs.data();
+            JoinRows(runs+prevBegin,prevEnd-prevBegin,prevBegin,runs+curBegin,curEnd-curBegin,curBegin,strip.parent.data());
+            prevBegin=curBegin;
+            prevEnd=curEnd;
+        }
+        strip.lastBegin=prevBegin;
+    });
+
+    int total=0;
+    for (LabelStrip &strip : strips){
+        strip.offset=total;
+        total+=(int)strip.runs.size();
+    }
+
+    //move the local roots to the global run indices
+    parent.resize(total);
+    ParallelFor(count,threads,[&](int s){
+        LabelStrip &strip=strips[s];
+        for (int i=0;i<(int)strip.runs.size();i++)
+            parent[strip.offset+i]=strip.offset+Find(strip.parent.data(),i);
+        std::vector<int>().swap(strip.parent);
+    });
+
+    //join the runs meeting across strip borders
+    for (int s=1;s<count;s++){
+        const LabelStrip &above=strips[s-1],&below=strips[s];
+        JoinRows(above.runs.data()+above.lastBegin,(int)above.runs.size()-above.lastBegin,above.offset+above.lastBegin,
+                 below.runs.data(),below.firstEnd,below.offset,parent.data());
+    }
+    return threads;
+}
+
+/*
+* LabelRegions
+* Description: Label every region of the framebuffer with runs joined by a union-find per strip and across strips
+* parameter: const Framebuffer fb, uint32_t bc, uint32_t fc, LabelImage out, int threads (0 = one per hardware thread)
+* return: number of regions
+*/
+int LabelRegions(const Framebuffer &fb,uint32_t bc,uint32_t fc,LabelImage &out,int threads){
+    out.width=fb.width;
+    out.height=fb.height;
+    out.labels.assign((size_t)fb.width*fb.height,0);
+    out.count=0;
+    if (fb.width<=0 || fb.height<=0)return 0;
+    std::vector<LabelStrip> strips;
+    std::vector<int> parent;
+    threads=BuildRegions(fb,bc,fc,threads,strips,parent);
+
+    //number the roots in scan order, a root is smaller than every other run of its set
+    std::vector<uint32_t> runLabel(parent.size());
+    for (int i=0;i<(int)parent.size();i++){
+        int root=Find(parent.data(),i);
+        runLabel[i]=root==i ? ++out.count : runLabel[root];
+    }
+
+    ParallelFor((int)strips.size(),threads,[&](int s){
+        const LabelStrip &strip=strips[s];
+        for (int i=0;i<(int)strip.runs.size();i++){
+            const LabelRun &r=strip.runs[i];
+            uint32_t *row=&out.labels[(size_t)r.y*fb.width];
+            std::fill(row+r.xleft,row+r.xright+1,runLabel[strip.offset+i]);
+        }
+    });
+    return out.count;
+}
+
+/*
+* ParallelFloodFill
+* Description: Fill the region of (x,y) using the strip labeling, every strip fills its runs of that region
+* parameter: Framebuffer fb, int x, int y, uint32_t bc, uint32_t fc, int threads (0 = one per hardware thread)
+* return: number of filled pixels
+*/
+long long ParallelFloodFill(Framebuffer &fb,int x,int y,uint32_t bc,uint32_t fc,int threads){
+    if ((unsigned)x>=(unsigned)fb.width || (unsigned)y>=(unsigned)fb.height)return 0;
+    uint32_t seed=fb.Row(y)[x];
+    if (seed==bc || seed==fc)return 0;
+    std::vector<LabelStrip> strips;
+    std::vector<int> parent;
+    threads=BuildRegions(fb,bc,fc,threads,strips,parent);
+
+    //the run holding the seed
+    const LabelStrip &seedStrip=strips[y/LABEL_STRIP_ROWS];
+    int seedRun=0;
+    while (seedStrip.runs[seedRun].y!=y || seedStrip.runs[seedRun].xright<x)seedRun++;
+    int root=Find(parent.data(),seedStrip.offset+seedRun);
+
+    //roots are final after the border joins, so the workers only read the parents
+    std::atomic<long long> filled(0);
+    ParallelFor((int)strips.size(),threads,[&](int s){
+        const LabelStrip &strip=strips[s];
+        long long count=0;
+        for (int i=0;i<(int)strip.runs.size();i++){
+            int r=strip.offset+i;
+            while (parent[r]!=r)r=parent[r];
+            if (r!=root)continue;
+            const LabelRun &run=strip.runs[i];
+            std::fill(fb.Row(run.y)+run.xleft,fb.Row(run.y)+run.xright+1,fc);
+            count+=run.xright-run.xleft+1;
+        }
+        filled+=count;
+    });
+    return filled;
+}
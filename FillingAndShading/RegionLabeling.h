@@ -0,0 +1,53 @@
+#ifndef FILLINGANDSHADING_REGIONLABELING_H
+#define FILLINGANDSHADING_REGIONLABELING_H
+
+#include <vector>
+#include "Raster.h"
+
+/*
+* LABEL_STRIP_ROWS
+* Description: height of the horizontal strips the image is split into for labeling, every strip is
+*              labeled by one worker and the strips are joined along their borders afterwards
+*/
+#define LABEL_STRIP_ROWS 256
+
+/*
+* struct LabelImage
+* Description: Region label of every pixel, the regions are the 4-connected areas of pixels that are
+*              neither the boundary nor the fill color (the areas myFloodFill fills)
+* width, height: size of the labeled framebuffer
+* labels: row by row labels, 0 for boundary / fill colored pixels, 1..count for the regions numbered in
+*         the order their first pixel is met scanning rows top to bottom
+* count: number of regions
+*/
+struct LabelImage {
+    int width=0,height=0;
+    std::vector<uint32_t> labels;
+    int count=0;
+};
+
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+
+/*
+* LabelRegions
+* Description: Label every region of the framebuffer with several threads. Each strip of LABEL_STRIP_ROWS
+*              rows is cut into runs of region pixels and the runs overlapping in consecutive rows are
+*              joined with a union-find, all strips at the same time. The runs meeting across strip
+*              borders are then joined in the same union-find and the labels are written strip by strip
+*              in parallel. The labels do not depend on the number of threads.
+* parameter: const Framebuffer fb, uint32_t bc, uint32_t fc, LabelImage out, int threads (0 = one per hardware thread)
+* return: number of regions
+*/
+int LabelRegions(const Framebuffer &fb,uint32_t bc,uint32_t fc,LabelImage &out,int threads = 0);
+/*
+* ParallelFloodFill
+* Description: Fill the same region as myFloodFill / ScanlineFloodFill from (x,y) using the strip labeling
+*              of LabelRegions, the runs of the seed's region are filled by the strip workers
+* parameter: Framebuffer fb, int x, int y, uint32_t bc, uint32_t fc, int threads (0 = one per hardware thread)
+* return: number of filled pixels
+*/
+long long ParallelFloodFill(Framebuffer &fb,int x,int y,uint32_t bc,uint32_t fc,int threads = 0);
+
+#endif //FILLINGANDSHADING_REGIONLABELING_H
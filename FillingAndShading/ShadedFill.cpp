@@ -0,0 +1,160 @@
+#include "ShadedFill.h"
+
+/*
+* InitShadedTable
+* Description: Initialize shaded table for a surface of the given height, only the rows used by the
+*              previous polygon are reset unless the height changed
+* parameter: ShadedTable t, int height
+*/
+void InitShadedTable(ShadedTable &t,int height){
+    ShadedEdgeRecord empty={INT_MAX,INT_MIN,0,0,{0,0,0},{0,0,0}};
+    if ((int)t.rows.size()!=height){
+        t.rows.assign(height,empty);
+    }else{
+        for (int i=t.ymin;i<=t.ymax;i++)
+            t.rows[i]=empty;
+    }
+    t.ymin=height;
+    t.ymax=-1;
+}
+
+/*
+* ShadedEdgeToTable
+* Description: Take edge with a color at each end update table, x is walked with the integer edge walker
+*              and each color channel is stepped by a 16.16 delta computed once per edge
+* parameter: point p1, COLORREF c1, point p2, COLORREF c2, ShadedTable t
+*/
+void ShadedEdgeToTable(point p1,COLORREF c1,point p2,COLORREF c2,ShadedTable &t){
+    //horizontal
+    if (p1.y==p2.y)return;
+
+    if (p1.y>p2.y){
+        std::swap(p1,p2);
+        std::swap(c1,c2);
+    }
+    int dx=p2.x-p1.x, dy=p2.y-p1.y;
+    int step=dx/dy, stepRem=dx%dy;
+    if (stepRem<0){
+        step--;
+        stepRem+=dy;
+    }
+
+    //clip the edge to the rows of the table
+    int yend=p2.y<(int)t.rows.size() ? p2.y : (int)t.rows.size();
+    int y=p1.y>0 ? p1.y : 0;
+    if (y>=yend)return;
+    if (y<t.ymin)t.ymin=y;
+    if (yend-1>t.ymax)t.ymax=yend-1;
+
+    int skip=y-p1.y;
+    long long num=(long long)p1.x*dy+(long long)skip*dx;
+    long long q=num/dy, r=num%dy;
+    if (r<0){
+        q--;
+        r+=dy;
+    }
+    int x=(int)q, rem=(int)r;
+
+    //16.16 x and colors, one division per edge
+    //x is kept in long long, a clipped shallow edge or |x|>=32768 would overflow an int
+    long long fxStep=(long long)dx*65536/dy;
+    long long fx=(long long)p1.x*65536+fxStep*skip;
+    int from[3]={GetRValue(c1),GetGValue(c1),GetBValue(c1)};
+    int to[3]={GetRValue(c2),GetGValue(c2),GetBValue(c2)};
+    int color[3],colorStep[3];
+    for (int k=0;k<3;k++){
+        colorStep[k]=(to[k]-from[k])*65536/dy;
+        color[k]=(int)((long long)from[k]*65536+(long long)colorStep[k]*skip);
+    }
+
+    while (y<yend){
+        ShadedEdgeRecord &row=t.rows[y];
+        int xceil=rem ? x+1 : x;
+        if (xceil<row.xleft){
+            row.xleft=xceil;
+            row.fxleft=fx;
+            for (int k=0;k<3;k++)row.left[k]=color[k];
+        }
+        if (x>row.xright){
+            row.xright=x;
+            row.fxright=fx;
+            for (int k=0;k<3;k++)row.right[k]=color[k];
+        }
+        y++;
+        x+=step;
+        rem+=stepRem;
+        if (rem>=dy){
+            rem-=dy;
+            x++;
+        }
+        fx+=fxStep;
+        for (int k=0;k<3;k++)color[k]+=colorStep[k];
+    }
+}
+
+/*
+* polygonToShadedTable
+* Description: Take polygon with one color per vertex update table
+* parameter: point p[], COLORREF c[], int n, ShadedTable t
+*/
+void polygonToShadedTable(point p[],COLORREF c[],int n,ShadedTable &t){
+    //start with last point
+    int v1=n-1;
+    for (int v2=0;v2<n;v2++){
+        ShadedEdgeToTable(p[v1],c[v1],p[v2],c[v2],t);
+        v1=v2;
+    }
+}
+
+/*
+* ClampChannel
+* Description: 16.16 channel to 0..255, rounding on the edges of the span can step just outside the range
+* parameter: int value
+*/
+static inline uint32_t ClampChannel(int value){
+    value>>=16;
+    return value<0 ? 0 : value>255 ? 255 : (uint32_t)value;
+}
+
+/*
+* shadedTableToScreen
+* Description: Take table write every row span into the framebuffer, the color is interpolated across the
+*              span with a 16.16 delta per channel computed once per row, so a pixel costs three additions
+* parameter: Framebuffer fb, ShadedTable t
+*/
+void shadedTableToScreen(Framebuffer &fb,const ShadedTable &t){
+    for (int i=t.ymin;i<=t.ymax;i++) {
+        const ShadedEdgeRecord &row=t.rows[i];
+        int xleft=row.xleft>0 ? row.xleft : 0;
+        int xright=row.xright<fb.width ? row.xright : fb.width;
+        if (xleft>=xright)continue;
+
+        long long width=row.fxright-row.fxleft;
+        int color[3],colorStep[3];
+        for (int k=0;k<3;k++){
+            colorStep[k]= width>0 ? (int)((long long)(row.right[k]-row.left[k])*65536/width) : 0;
+            //move from the exact left edge to the center of the first written pixel
+            color[k]=row.left[k]+(int)((((long long)xleft<<16)+32768-row.fxleft)*colorStep[k]>>16);
+        }
+        uint32_t *out=fb.Row(i);
+        for (int x=xleft;x<xright;x++){
+            out[x]=0xFF000000u|(ClampChannel(color[0])<<16)|(ClampChannel(color[1])<<8)|ClampChannel(color[2]);
+            color[0]+=colorStep[0];
+            color[1]+=colorStep[1];
+            color[2]+=colorStep[2];
+        }
+    }
+}
+
+/*
+* GouraudFill
+* Description: Fill convex polygon with the vertex colors interpolated over its inside (Gouraud shading),
+*              the table is thread_local so it is reused between calls and every thread fills with its own
+* parameter: Framebuffer fb, point p[], COLORREF c[], int n
+*/
+void GouraudFill(Framebuffer &fb,point p[],COLORREF c[],int n){
+    thread_local ShadedTable t;
+    InitShadedTable(t,fb.height);
+    polygonToShadedTable(p,c,n,t);
+    shadedTableToScreen(fb,t);
+}
@@ -0,0 +1,70 @@
+#ifndef FILLINGANDSHADING_SHADEDFILL_H
+#define FILLINGANDSHADING_SHADEDFILL_H
+
+#include <windows.h>
+#include <climits>
+#include <vector>
+#include "Raster.h"
+
+/*
+* struct ShadedEdgeRecord
+* xleft, xright: first pixel and pixel after the last one of the row span, same rule as ConvexFill
+* fxleft, fxright: exact x of the left and right edges in 16.16 fixed point
+* left, right: r,g,b of the left and right edges in 16.16 fixed point
+*/
+struct ShadedEdgeRecord {
+    int xleft,xright;
+    long long fxleft,fxright;
+    int left[3],right[3];
+};
+
+/*
+* struct ShadedTable
+* rows: one ShadedEdgeRecord per row of the target surface
+* ymin, ymax: rows touched by the polygon, reused between fills like Table
+*/
+struct ShadedTable {
+    std::vector<ShadedEdgeRecord> rows;
+    int ymin=0,ymax=-1;
+};
+
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+
+/*
+* InitShadedTable
+* Description: Initialize shaded table for a surface of the given height, only the rows used by the
+*              previous polygon are reset unless the height changed
+* parameter: ShadedTable t, int height
+*/
+void InitShadedTable(ShadedTable &t,int height);
+/*
+* ShadedEdgeToTable
+* Description: Take edge with a color at each end update table, x is walked with the integer edge walker
+*              and each color channel is stepped by a 16.16 delta computed once per edge
+* parameter: point p1, COLORREF c1, point p2, COLORREF c2, ShadedTable t
+*/
+void ShadedEdgeToTable(point p1,COLORREF c1,point p2,COLORREF c2,ShadedTable &t);
+/*
+* polygonToShadedTable
+* Description: Take polygon with one color per vertex update table
+* parameter: point p[], COLORREF c[], int n, ShadedTable t
+*/
+void polygonToShadedTable(point p[],COLORREF c[],int n,ShadedTable &t);
+/*
+* shadedTableToScreen
+* Description: Take table write every row span into the framebuffer, the color is interpolated across the
+*              span with a 16.16 delta per channel computed once per row, so a pixel costs three additions
+* parameter: Framebuffer fb, ShadedTable t
+*/
+void shadedTableToScreen(Framebuffer &fb,const ShadedTable &t);
+/*
+* GouraudFill
+* Description: Fill convex polygon with the vertex colors interpolated over its inside (Gouraud shading),
+*              the table is thread_local so it is reused between calls and every thread fills with its own
+* parameter: Framebuffer fb, point p[], COLORREF c[], int n
+*/
+void GouraudFill(Framebuffer &fb,point p[],COLORREF c[],int n);
+
+#endif //FILLINGANDSHADING_SHADEDFILL_H
@@ -0,0 +1,245 @@
+#include "TriangleFill.h"
+#include "PolygonFill.h"
+#include "ConvexFill.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TRIANGLE_SSE2 1
+#endif
+
+/*
+* MakeEdgeFunction
+* Description: Edge function of the edge p0->p1 of a triangle ordered so its inside is on the positive side
+* parameter: point p0, point p1
+*/
+EdgeFunction MakeEdgeFunction(point p0,point p1){
+    int dx=p1.x-p0.x, dy=p1.y-p0.y;
+    EdgeFunction e;
+    //E = dx*(y-y0) - dy*(x-x0)
+    e.a=-dy;
+    e.b=dx;
+    e.c=dy*p0.x-dx*p0.y;
+    //top edge (horizontal going right) or left edge (going up) keeps the pixels exactly on it
+    bool topLeft= dy<0 || (dy==0 && dx>0);
+    if (!topLeft)
+        e.c-=1;
+    return e;
+}
+
+/*
+* Evaluate
+* Description: value of the edge function at (x,y)
+* parameter: EdgeFunction e, int x, int y
+*/
+static inline int Evaluate(const EdgeFunction &e,int x,int y){
+    return e.a*x+e.b*y+e.c;
+}
+
+/*
+* FloorDivide
+* Description: n/d rounded toward minus infinity, d > 0
+* parameter: int n, int d
+*/
+static inline int FloorDivide(int n,int d){
+    int q=n/d;
+    if (n%d!=0 && n<0)
+        q--;
+    return q;
+}
+
+/*
+* struct EdgeWalker
+* Description: walks one edge down the rows of a band like EdgeToTableInteger: out is the number of pixels
+*              the edge leaves outside counted from a fixed x (rightward for an edge with a > 0, leftward for
+*              an edge with a < 0), rest is the edge value at the first inside pixel, in [0, a)
+*/
+struct EdgeWalker {
+    int out,rest,stepOut,stepRest,a;
+};
+
+/*
+* MakeEdgeWalker
+* Description: EdgeWalker of the edge e, only its steps: every pixel toward the inside adds |a| to E and one
+*              row down adds b = stepOut*|a| + stepRest
+* parameter: EdgeFunction e
+*/
+static EdgeWalker MakeEdgeWalker(const EdgeFunction &e){
+    EdgeWalker w;
+    w.a=e.a<0 ? -e.a : e.a;
+    w.stepOut=FloorDivide(e.b,w.a);
+    w.stepRest=e.b-w.stepOut*w.a;
+    w.out=w.rest=0;
+    return w;
+}
+
+/*
+* StartEdgeWalker
+* Description: Place the EdgeWalker of the edge e at pixel (x,y), out is the smallest count with E + out*|a| >= 0
+* parameter: EdgeWalker w, EdgeFunction e, int x, int y
+*/
+static inline void StartEdgeWalker(EdgeWalker &w,const EdgeFunction &e,int x,int y){
+    int value=Evaluate(e,x,y);
+    w.out=FloorDivide(-value+w.a-1,w.a);
+    w.rest=value+w.out*w.a;
+}
+
+/*
+* NextRow
+* Description: Move the EdgeWalker one row down, without a branch since the carry is taken at random
+* parameter: EdgeWalker w
+*/
+static inline void NextRow(EdgeWalker &w){
+    w.rest+=w.stepRest;
+    w.out-=w.stepOut;
+    int carry=-(w.rest>=w.a);
+    w.rest-=w.a&carry;
+    w.out+=carry;
+}
+
+/*
+* FillRow
+* Description: Write pixel to [x0,x1) of the row, 4 pixels per store with SSE2
+* parameter: uint32_t row[], int x0, int x1, uint32_t pixel
+*/
+static inline void FillRow(uint32_t *row,int x0,int x1,uint32_t pixel){
+    int x=x0;
+#ifdef TRIANGLE_SSE2
+    const __m128i color=_mm_set1_epi32((int)pixel);
+    for (;x+4<=x1;x+=4)
+        _mm_storeu_si128((__m128i *)(row+x),color);
+#endif
+    for (;x<x1;x++)
+        row[x]=pixel;
+}
+
+/*
+* TriangleFill
+* Description: Fill triangle with the half-space algorithm: TRIANGLE_BLOCK x TRIANGLE_BLOCK blocks are trivially
+*              rejected or accepted from their corners, the ends of every row span are found in the partial
+*              blocks by walking the edges that cross them
+* parameter: Framebuffer fb, point v0, point v1, point v2, uint32_t pixel
+*/
+void TriangleFill(Framebuffer &fb,point v0,point v1,point v2,uint32_t pixel){
+    point v[3]={v0,v1,v2};
+    //the block setup costs more than the whole span table of ConvexFill on small triangles
+    long long width=(long long)std::max(v0.x,std::max(v1.x,v2.x))-std::min(v0.x,std::min(v1.x,v2.x));
+    long long height=(long long)std::max(v0.y,std::max(v1.y,v2.y))-std::min(v0.y,std::min(v1.y,v2.y));
+    if (width<TRIANGLE_SMALL_SIZE && height<TRIANGLE_SMALL_SIZE){
+        ConvexFill(fb,v,3,pixel);
+        return;
+    }
+    for (int i=0;i<3;i++){
+        if (v[i].x<-TRIANGLE_COORD_LIMIT || v[i].x>=TRIANGLE_COORD_LIMIT || v[i].y<-TRIANGLE_COORD_LIMIT || v[i].y>=TRIANGLE_COORD_LIMIT){
+            GeneralPolygonFill(fb,v,3,pixel,FILL_NON_ZERO);
+            return;
+        }
+    }
+    //order the vertices so the inside is on the positive side of every edge
+    long long area=(long long)(v1.x-v0.x)*(v2.y-v0.y)-(long long)(v1.y-v0.y)*(v2.x-v0.x);
+    if (area==0)return;
+    if (area<0)std::swap(v1,v2);
+    EdgeFunction e[3]={MakeEdgeFunction(v0,v1),MakeEdgeFunction(v1,v2),MakeEdgeFunction(v2,v0)};
+
+    //bounding box clipped to the framebuffer
+    int xmin=std::max(std::min(v0.x,std::min(v1.x,v2.x)),0);
+    int xmax=std::min(std::max(v0.x,std::max(v1.x,v2.x)),fb.width-1);
+    int ymin=std::max(std::min(v0.y,std::min(v1.y,v2.y)),0);
+    int ymax=std::min(std::max(v0.y,std::max(v1.y,v2.y)),fb.height-1);
+    //a horizontal edge can only leave out its own row, the bottom row of the box when it is a bottom edge
+    for (int k=0;k<3;k++){
+        if (e[k].a!=0)continue;
+        if (ymin<=ymax && Evaluate(e[k],0,ymin)<0)ymin++;
+        if (ymin<=ymax && Evaluate(e[k],0,ymax)<0)ymax--;
+    }
+    if (xmin>xmax || ymin>ymax)return;
+
+    //E is linear, so over a block it is largest and smallest at the corners picked by the signs of a and b:
+    //a block is outside when the largest value of one edge is negative, inside when the smallest values
+    //of all three edges are >= 0
+    const int B=TRIANGLE_BLOCK;
+    int most[3],least[3],step[3];
+    for (int k=0;k<3;k++){
+        most[k]=std::max(0,(B-1)*e[k].a)+std::max(0,(B-1)*e[k].b);
+        least[k]=std::min(0,(B-1)*e[k].a)+std::min(0,(B-1)*e[k].b);
+        step[k]=B*e[k].a;
+    }
+    EdgeWalker walker[3];
+    for (int k=0;k<3;k++){
+        if (e[k].a!=0)
+            walker[k]=MakeEdgeWalker(e[k]);
+    }
+#ifdef TRIANGLE_SSE2
+    //one lane per edge, the unused fourth lane never rejects and never refuses
+    const __m128i mostV=_mm_set_epi32(0,most[2],most[1],most[0]);
+    const __m128i leastV=_mm_set_epi32(0,least[2],least[1],least[0]);
+    const __m128i stepV=_mm_set_epi32(0,step[2],step[1],step[0]);
+    const __m128i zero=_mm_setzero_si128();
+#endif
+    int bxmin=xmin-xmin%B;
+    for (int by=ymin-ymin%B;by<=ymax;by+=B){
+        //classify the blocks of the row, the triangle is convex so the blocks that are not rejected are one
+        //run [first,last) and the accepted blocks one run [acceptFirst,acceptLast) inside it
+        int first=-1,last=-1,acceptFirst=-1,acceptLast=-1;
+#ifdef TRIANGLE_SSE2
+        __m128i w=_mm_set_epi32(0,Evaluate(e[2],bxmin,by),Evaluate(e[1],bxmin,by),Evaluate(e[0],bxmin,by));
+        for (int bx=bxmin;bx<=xmax;bx+=B){
+            bool rejected=_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(_mm_add_epi32(w,mostV),zero)))!=0;
+            bool accepted=_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(_mm_add_epi32(w,leastV),zero)))==0;
+            w=_mm_add_epi32(w,stepV);
+#else
+        int w[3]={Evaluate(e[0],bxmin,by),Evaluate(e[1],bxmin,by),Evaluate(e[2],bxmin,by)};
+        for (int bx=bxmin;bx<=xmax;bx+=B){
+            bool rejected= w[0]+most[0]<0 || w[1]+most[1]<0 || w[2]+most[2]<0;
+            bool accepted= w[0]+least[0]>=0 && w[1]+least[1]>=0 && w[2]+least[2]>=0;
+            for (int k=0;k<3;k++)
+                w[k]+=step[k];
+#endif
+            if (rejected){
+                if (first>=0)break;
+                continue;
+            }
+            if (first<0)first=bx;
+            last=bx+B;
+            if (accepted){
+                if (acceptFirst<0)acceptFirst=bx;
+                acceptLast=bx+B;
+            }
+        }
+        if (first<0)continue;
+
+        //only an edge with a > 0 leaves pixels out on the left, and only in the partial blocks before the
+        //accepted run when it is negative somewhere in the first block, the same on the right for a < 0
+        int leftEnd=acceptFirst>=0 ? acceptFirst : last;
+        int rightBegin=acceptFirst>=0 ? acceptLast : first;
+        int y0=std::max(by,ymin),y1=std::min(by+B-1,ymax);
+        EdgeWalker left[3],right[3];
+        int lefts=0,rights=0;
+        for (int k=0;k<3;k++){
+            if (e[k].a>0 && first<leftEnd && Evaluate(e[k],first,by)+least[k]<0){
+                left[lefts]=walker[k];
+                StartEdgeWalker(left[lefts++],e[k],first,y0);
+            }
+            if (e[k].a<0 && rightBegin<last && Evaluate(e[k],last-B,by)+least[k]<0){
+                right[rights]=walker[k];
+                StartEdgeWalker(right[rights++],e[k],last-1,y0);
+            }
+        }
+
+        //the covered pixels of a row are one span, written in one go so memory is walked in order
+        for (int y=y0;y<=y1;y++){
+            int xs=first,xe=last;
+            for (int k=0;k<lefts;k++){
+                xs=std::max(xs,first+left[k].out);
+                NextRow(left[k]);
+            }
+            for (int k=0;k<rights;k++){
+                xe=std::min(xe,last-right[k].out);
+                NextRow(right[k]);
+            }
+            xs=std::max(xs,xmin);
+            xe=std::min(xe,xmax+1);
+            if (xs<xe)
+                FillRow(fb.Row(y),xs,xe,pixel);
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#ifndef FILLINGANDSHADING_TRIANGLEFILL_H
+#define FILLINGANDSHADING_TRIANGLEFILL_H
+
+#include "Raster.h"
+
+/*
+* TRIANGLE_BLOCK
+* Description: side of the square pixel blocks the triangle rasterizer classifies at once, a block is
+*              rejected, accepted or partial from the edge values at its corners
+*/
+#define TRIANGLE_BLOCK 8
+
+/*
+* TRIANGLE_SMALL_SIZE
+* Description: triangles whose bounding box is narrower and lower than this are filled with ConvexFill, the
+*              block setup does not pay off on them
+*/
+#define TRIANGLE_SMALL_SIZE 64
+
+/*
+* TRIANGLE_COORD_LIMIT
+* Description: vertices must lie in [-TRIANGLE_COORD_LIMIT, TRIANGLE_COORD_LIMIT) for the edge functions to
+*              fit in 32 bit SIMD lanes, larger triangles are filled with GeneralPolygonFill instead
+*/
+#define TRIANGLE_COORD_LIMIT 8192
+
+/*
+* struct EdgeFunction
+* Description: half-space of one triangle edge, E(x,y) = a*x + b*y + c is >= 0 for the pixels on the
+*              inside of the edge, c already holds the top-left rule bias
+*/
+struct EdgeFunction {
+    int a,b,c;
+};
+
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+
+/*
+* MakeEdgeFunction
+* Description: Edge function of the edge p0->p1 of a triangle ordered so its inside is on the positive side,
+*              pixels exactly on a top or left edge are inside, on a bottom or right edge outside, so
+*              triangles sharing an edge never write the same pixel twice
+* parameter: point p0, point p1
+*/
+EdgeFunction MakeEdgeFunction(point p0,point p1);
+/*
+* TriangleFill
+* Description: Fill triangle with the half-space algorithm: the bounding box is walked in bands of
+*              TRIANGLE_BLOCK rows cut in TRIANGLE_BLOCK x TRIANGLE_BLOCK blocks, the three edge functions
+*              are stepped from block to block together in one SSE2 register (scalar code when SSE2 is not
+*              available). A block is rejected when one edge is negative at all its corners and accepted
+*              when the three are >= 0 at all of them, accepted blocks are written without any test. Only
+*              the edges that are negative somewhere in the partial blocks at the ends of a band are walked
+*              down its rows, like EdgeToTableInteger, to find where every row span starts and ends. Spans
+*              are written with 4 pixel SSE2 stores one row after the other so memory is walked in order.
+*              Triangles smaller than TRIANGLE_SMALL_SIZE go to ConvexFill, whose spans can end one pixel
+*              earlier on the right.
+* parameter: Framebuffer fb, point v0, point v1, point v2, uint32_t pixel
+*/
+void TriangleFill(Framebuffer &fb,point v0,point v1,point v2,uint32_t pixel);
+
+#endif //FILLINGANDSHADING_TRIANGLEFILL_H
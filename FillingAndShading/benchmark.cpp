@@ -0,0 +1,219 @@
+#include <windows.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "Raster.h"
+#include "ConvexFill.h"
+#include "TriangleFill.h"
+#include "BatchFill.h"
+
+/*
+ * Filling benchmark
+ * Description: Measures polygons per second of the fill paths on a tall headless framebuffer.
+ * usage: FillingAndShadingBenchmark [surfaceHeight]   (default 4320, an 8K canvas)
+ */
+
+/*
+* struct BenchPolygon
+* Description: one polygon of the benchmark workload
+*/
+struct BenchPolygon {
+    std::vector<point> p;
+};
+
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+
+/*
+* RandomConvexPolygons
+* Description: Generate count convex polygons with n vertices on a circle of the given radius placed at
+*              random in a width x height surface, a little jitter keeps the edges at arbitrary slopes
+* parameter: int count, int n, int radius, int width, int height
+*/
+std::vector<BenchPolygon> RandomConvexPolygons(int count, int n, int radius, int width, int height);
+/*
+* PolygonsPerSecond
+* Description: Run fill over every polygon repeatedly for about a quarter of a second
+* parameter: vector<BenchPolygon> polygons, fill function
+*/
+template <typename Fill>
+double PolygonsPerSecond(std::vector<BenchPolygon> &polygons, Fill fill);
+/*
+* ExactPolygonToTable
+* Description: Reference table, x of every edge at every row is computed on its own as the exact fraction
+*              (x1*dy + (y-y1)*dx) / dy and rounded with integer division, nothing is accumulated
+* parameter: BenchPolygon poly, Table t
+*/
+void ExactPolygonToTable(const BenchPolygon &poly, Table &t);
+/*
+* SameTable
+* Description: true when both tables cover the same rows with the same xleft/xright
+* parameter: Table a, Table b
+*/
+bool SameTable(const Table &a, const Table &b);
+
+int main(int argc, char **argv)
+{
+    int height = argc > 1 ? atoi(argv[1]) : 4320;
+    if (height < 64)
+        height = 64;
+    int width = height * 16 / 9;
+    Framebuffer fb(width, height);
+    Table t;
+    srand(1);
+
+    printf("Convex fill, %dx%d surface\n", width, height);
+    printf("%8s %16s %16s %16s %16s %14s %14s\n", "radius", "table double/s", "table integer/s", "fill double/s", "fill integer/s", "double!=exact", "integer!=exact");
+    for (int radius = 4; radius <= height / 4; radius *= 4) {
+        std::vector<BenchPolygon> polygons = RandomConvexPolygons(1000, 8, radius, width, height);
+
+        // compare both walkers with the exact table, the double walker drifts when x lands on an integer
+        int doubleMismatches = 0, integerMismatches = 0;
+        Table exact, a, b;
+        for (BenchPolygon &poly : polygons) {
+            InitTable(exact, height);
+            InitTable(a, height);
+            InitTable(b, height);
+            ExactPolygonToTable(poly, exact);
+            polygonToTable(poly.p.data(), (int)poly.p.size(), a);
+            polygonToTableInteger(poly.p.data(), (int)poly.p.size(), b);
+            doubleMismatches += !SameTable(exact, a);
+            integerMismatches += !SameTable(exact, b);
+        }
+
+        double tableDouble = PolygonsPerSecond(polygons, [&](BenchPolygon &poly) {
+            InitTable(t, height);
+            polygonToTable(poly.p.data(), (int)poly.p.size(), t);
+        });
+        double tableInteger = PolygonsPerSecond(polygons, [&](BenchPolygon &poly) {
+            InitTable(t, height);
+            polygonToTableInteger(poly.p.data(), (int)poly.p.size(), t);
+        });
+        double fillDouble = PolygonsPerSecond(polygons, [&](BenchPolygon &poly) {
+            InitTable(t, height);
+            polygonToTable(poly.p.data(), (int)poly.p.size(), t);
+            tableToScreen(fb, t, 0xFF000000);
+        });
+        double fillInteger = PolygonsPerSecond(polygons, [&](BenchPolygon &poly) {
+            InitTable(t, height);
+            polygonToTableInteger(poly.p.data(), (int)poly.p.size(), t);
+            tableToScreen(fb, t, 0xFF000000);
+        });
+        printf("%8d %16.0f %16.0f %16.0f %16.0f %14d %14d\n", radius, tableDouble, tableInteger, fillDouble, fillInteger, doubleMismatches, integerMismatches);
+    }
+
+    printf("\nTriangles, %dx%d surface\n", width, height);
+    printf("%8s %16s %16s\n", "radius", "ConvexFill/s", "TriangleFill/s");
+    for (int radius = 4; radius <= height / 4; radius *= 4) {
+        std::vector<BenchPolygon> triangles = RandomConvexPolygons(1000, 3, radius, width, height);
+        double convex = PolygonsPerSecond(triangles, [&](BenchPolygon &tri) {
+            ConvexFill(fb, tri.p.data(), 3, 0xFF000000);
+        });
+        double halfSpace = PolygonsPerSecond(triangles, [&](BenchPolygon &tri) {
+            TriangleFill(fb, tri.p[0], tri.p[1], tri.p[2], 0xFF000000);
+        });
+        printf("%8d %16.0f %16.0f\n", radius, convex, halfSpace);
+    }
+
+    // a map tile worth of overlapping polygons, serial ConvexFill against the banded batch fill
+    std::vector<BenchPolygon> tile = RandomConvexPolygons(50000, 6, 48, width, height);
+    std::vector<BatchPolygon> batch;
+    for (size_t i = 0; i < tile.size(); i++)
+        batch.push_back(BatchPolygon{tile[i].p.data(), (int)tile[i].p.size(), 0xFF000000u | (uint32_t)(i * 2654435761u & 0xFFFFFF)});
+    Framebuffer serial(width, height), banded(width, height);
+    auto start = std::chrono::steady_clock::now();
+    for (const BatchPolygon &poly : batch)
+        ConvexFill(serial, (point *)poly.p, poly.n, poly.pixel);
+    double serialMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    start = std::chrono::steady_clock::now();
+    BatchConvexFill(banded, batch);
+    double bandedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    printf("\n%zu polygons: serial ConvexFill %.1f ms, BatchConvexFill %.1f ms (%u threads), %s\n", batch.size(), serialMs, bandedMs,
+           std::thread::hardware_concurrency(), serial.pixels == banded.pixels ? "same pixels" : "PIXELS DIFFER");
+    return 0;
+}
+
+/*
+* RandomConvexPolygons
+* Description: Generate count convex polygons with n vertices on a circle of the given radius placed at
+*              random in a width x height surface, a little jitter keeps the edges at arbitrary slopes
+* parameter: int count, int n, int radius, int width, int height
+*/
+std::vector<BenchPolygon> RandomConvexPolygons(int count, int n, int radius, int width, int height){
+    std::vector<BenchPolygon> polygons(count);
+    for (BenchPolygon &poly : polygons) {
+        double xc = radius + rand() % std::max(1, width - 2 * radius);
+        double yc = radius + rand() % std::max(1, height - 2 * radius);
+        double start = (rand() % 1000) / 1000.0;
+        for (int i = 0; i < n; i++) {
+            double theta = start + 2 * 3.14159265358979323846 * i / n;
+            poly.p.push_back(point((int)(xc + radius * cos(theta)), (int)(yc + radius * sin(theta))));
+        }
+    }
+    return polygons;
+}
+
+/*
+* PolygonsPerSecond
+* Description: Run fill over every polygon repeatedly for about a quarter of a second
+* parameter: vector<BenchPolygon> polygons, fill function
+*/
+template <typename Fill>
+double PolygonsPerSecond(std::vector<BenchPolygon> &polygons, Fill fill){
+    long long done = 0;
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0;
+    while (elapsed < 0.25) {
+        for (BenchPolygon &poly : polygons)
+            fill(poly);
+        done += polygons.size();
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    return done / elapsed;
+}
+
+/*
+* ExactPolygonToTable
+* Description: Reference table, x of every edge at every row is computed on its own as the exact fraction
+*              (x1*dy + (y-y1)*dx) / dy and rounded with integer division, nothing is accumulated
+* parameter: BenchPolygon poly, Table t
+*/
+void ExactPolygonToTable(const BenchPolygon &poly, Table &t){
+    int n = (int)poly.p.size();
+    for (int i = 0; i < n; i++) {
+        point p1 = poly.p[(i + n - 1) % n], p2 = poly.p[i];
+        if (p1.y == p2.y)
+            continue;
+        if (p1.y > p2.y)
+            std::swap(p1, p2);
+        long long dx = p2.x - p1.x, dy = p2.y - p1.y;
+        for (int y = std::max(p1.y, 0); y < std::min(p2.y, (int)t.rows.size()); y++) {
+            long long num = p1.x * dy + (y - p1.y) * dx;
+            long long fl = num / dy - (num % dy < 0);
+            long long ce = fl + (num % dy != 0);
+            t.rows[y].xleft = std::min(t.rows[y].xleft, (int)ce);
+            t.rows[y].xright = std::max(t.rows[y].xright, (int)fl);
+            t.ymin = std::min(t.ymin, y);
+            t.ymax = std::max(t.ymax, y);
+        }
+    }
+}
+
+/*
+* SameTable
+* Description: true when both tables cover the same rows with the same xleft/xright
+* parameter: Table a, Table b
+*/
+bool SameTable(const Table &a, const Table &b){
+    if (a.ymin != b.ymin || a.ymax != b.ymax)
+        return false;
+    for (int y = a.ymin; y <= a.ymax; y++)
+        if (a.rows[y].xleft != b.rows[y].xleft || a.rows[y].xright != b.rows[y].xright)
+            return false;
+    return true;
+}
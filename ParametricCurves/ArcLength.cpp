@@ -0,0 +1,104 @@
+#include "ArcLength.h"
+#include <algorithm>
+#include <cmath>
+
+/*
+ * Hashes the 8 doubles of the key, see HashDoubles for -0.0.
+ */
+size_t ArcLengthKeyHash::operator()(const ArcLengthKey& key) const {
+    return HashDoubles(key.v, 8, 0);
+}
+
+/*
+ * Builds the cumulative length table of a Hermite segment. The samples are walked with forward differencing
+ * (see MakeCubicStepper) and the chord lengths between them are summed.
+ */
+void BuildArcLengthTable(ArcLengthTable& table, Vector2& Point1, Vector2& Tangential_Point1, Vector2& Point2, Vector2& Tangential_Point2) {
+    table.Xcoeff = GetHermiteCoeff(Point1.x, Tangential_Point1.x, Point2.x, Tangential_Point2.x);
+    table.Ycoeff = GetHermiteCoeff(Point1.y, Tangential_Point1.y, Point2.y, Tangential_Point2.y);
+    CubicStepper X = MakeCubicStepper(table.Xcoeff, 1.0 / ARC_LENGTH_SAMPLES);
+    CubicStepper Y = MakeCubicStepper(table.Ycoeff, 1.0 / ARC_LENGTH_SAMPLES);
+    double length = 0;
+    table.length[0] = 0;
+    for (int i = 1; i <= ARC_LENGTH_SAMPLES; i++) {
+        double x = X.f, y = Y.f;
+        X.f += X.d1; X.d1 += X.d2; X.d2 += X.d3;
+        Y.f += Y.d1; Y.d1 += Y.d2; Y.d2 += Y.d3;
+        length += std::sqrt((X.f - x) * (X.f - x) + (Y.f - y) * (Y.f - y));
+        table.length[i] = (float)length;
+    }
+}
+
+/*
+ * Parameter t at which the segment has length s: binary search for the table interval holding s, then
+ * linear interpolation inside it. s is clamped to [0, Total()].
+ */
+double ParameterAtDistance(const ArcLengthTable& table, double s) {
+    if (s <= 0) return 0;
+    if (s >= table.Total()) return 1;
+    /* first entry with length > s, the interval is [i-1, i] */
+    int i = (int)(std::upper_bound(table.length, table.length + ARC_LENGTH_SAMPLES + 1, (float)s) - table.length);
+    if (i > ARC_LENGTH_SAMPLES) return 1;
+    double l0 = table.length[i - 1], l1 = table.length[i];
+    double f = l1 > l0 ? (s - l0) / (l1 - l0) : 0;
+    return (i - 1 + f) / ARC_LENGTH_SAMPLES;
+}
+
+/*
+ * Point of the segment at distance s from its start.
+ */
+Vector2 PointAtDistance(const ArcLengthTable& table, double s) {
+    double t = ParameterAtDistance(table, s);
+    Vector4 vt(t * t * t, t * t, t, 1);
+    return Vector2(DotProduct(table.Xcoeff, vt), DotProduct(table.Ycoeff, vt));
+}
+
+/*
+ * Returns the table of a segment, built and stored on the first request.
+ */
+const ArcLengthTable& ArcLengthCache::Get(Vector2& Point1, Vector2& Tangential_Point1, Vector2& Point2, Vector2& Tangential_Point2) {
+    ArcLengthKey key = {{Point1.x, Point1.y, Tangential_Point1.x, Tangential_Point1.y,
+                         Point2.x, Point2.y, Tangential_Point2.x, Tangential_Point2.y}};
+    auto found = tables.find(key);
+    if (found != tables.end()) {
+        hits++;
+        return found->second;
+    }
+    misses++;
+    ArcLengthTable& table = tables[key];
+    BuildArcLengthTable(table, Point1, Tangential_Point1, Point2, Tangential_Point2);
+    return table;
+}
+
+/*
+ * Builds the path of a cardinal spline over the same intervals as DrawCardinalSpline (P[1]..P[n-2]), with the
+ * tangent Ti=(1-c)(Pi+1-Pi-1) at both ends of every interval. The tables come from the cache.
+ */
+void BuildCardinalPath(ArcLengthCache& cache, Vector2 P[], int n, double tension, ArcLengthPath& path) {
+    path.segments.clear();
+    path.start.clear();
+    path.total = 0;
+    if (n < 4) return;
+    double c = 1 - tension;
+    Vector2 T0(c * (P[2].x - P[0].x), c * (P[2].y - P[0].y));
+    for (int i = 1; i < n - 2; i++) {
+        Vector2 T1(c * (P[i + 2].x - P[i].x), c * (P[i + 2].y - P[i].y));
+        const ArcLengthTable& table = cache.Get(P[i], T0, P[i + 1], T1);
+        path.segments.push_back(&table);
+        path.start.push_back(path.total);
+        path.total += table.Total();
+        T0 = T1;
+    }
+}
+
+/*
+ * Point of the path at distance s from its start: binary search for the segment, then for the parameter
+ * inside the segment. s is clamped to [0, total].
+ */
+Vector2 PointAtDistance(const ArcLengthPath& path, double s) {
+    if (path.segments.empty()) return Vector2();
+    s = std::max(0.0, std::min(s, path.total));
+    int i = (int)(std::upper_bound(path.start.begin(), path.start.end(), s) - path.start.begin()) - 1;
+    if (i < 0) i = 0;
+    return PointAtDistance(*path.segments[i], s - path.start[i]);
+}
@@ -0,0 +1,71 @@
+#ifndef PARAMETRICCURVES_ARCLENGTH_H
+#define PARAMETRICCURVES_ARCLENGTH_H
+
+#include <unordered_map>
+#include <vector>
+#include "Curves.h"
+
+/*
+ * Number of intervals of the cumulative length table of one segment, the length at t=i/ARC_LENGTH_SAMPLES is
+ * stored for i=0..ARC_LENGTH_SAMPLES.
+ */
+#define ARC_LENGTH_SAMPLES 64
+
+/*
+ * Arc length table of one Hermite segment: the cubic coefficients and the length of the curve from t=0 to
+ * t=i/ARC_LENGTH_SAMPLES, measured along the chords between the samples. The lengths are floats so a table
+ * is 324 bytes.
+ */
+struct ArcLengthTable {
+    Vector4 Xcoeff, Ycoeff;
+    float length[ARC_LENGTH_SAMPLES + 1];
+    double Total() const { return length[ARC_LENGTH_SAMPLES]; }
+};
+
+/*
+ * Control data of a Hermite segment, the key of ArcLengthCache.
+ */
+struct ArcLengthKey {
+    double v[8];
+    bool operator==(const ArcLengthKey& other) const {
+        for (int i = 0; i < 8; i++)
+            if (v[i] != other.v[i]) return false;
+        return true;
+    }
+};
+
+struct ArcLengthKeyHash {
+    size_t operator()(const ArcLengthKey& key) const;
+};
+
+/*
+ * Arc length tables of the segments seen so far keyed by their control points and tangents, so a segment's
+ * table is built the first time it is asked for and reused on the next frames. The tables are nodes of the
+ * map and keep their address until Clear.
+ */
+struct ArcLengthCache {
+    std::unordered_map<ArcLengthKey, ArcLengthTable, ArcLengthKeyHash> tables;
+    long long hits = 0, misses = 0;
+    const ArcLengthTable& Get(Vector2& Point1, Vector2& Tangential_Point1, Vector2& Point2, Vector2& Tangential_Point2);
+    void Clear() { tables.clear(); }
+};
+
+/*
+ * Arc length parameterization of consecutive segments (a spline): start[i] is the distance at which segment i
+ * begins, total the length of the whole path.
+ */
+struct ArcLengthPath {
+    std::vector<const ArcLengthTable*> segments;
+    std::vector<double> start;
+    double total = 0;
+};
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+void BuildArcLengthTable(ArcLengthTable& table, Vector2& Point1, Vector2& Tangential_Point1, Vector2& Point2, Vector2& Tangential_Point2);
+double ParameterAtDistance(const ArcLengthTable& table, double s);
+Vector2 PointAtDistance(const ArcLengthTable& table, double s);
+void BuildCardinalPath(ArcLengthCache& cache, Vector2 P[], int n, double tension, ArcLengthPath& path);
+Vector2 PointAtDistance(const ArcLengthPath& path, double s);
+
+#endif //PARAMETRICCURVES_ARCLENGTH_H
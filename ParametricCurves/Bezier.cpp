@@ -0,0 +1,141 @@
+#include "Bezier.h"
+#include <cmath>
+
+/* Bezier curves of any degree
+ * A Bezier curve of degree n has n+1 control points P0..Pn and is
+ *     P(t) = sum over i of C(n,i) (1-t)^(n-i) t^i Pi
+ * de Casteljau evaluates it by repeated linear interpolation: every pass replaces the k points of the previous
+ * pass by the k-1 points (1-t) Pi + t Pi+1, and after n passes one point, P(t), is left. The first and last
+ * point of every pass are the control points of the two halves of the curve split at t.
+ * */
+
+/*
+ * Point of the curve of the given degree (1..BEZIER_MAX_DEGREE) at t, evaluated with de Casteljau in a stack buffer.
+ */
+Vector2 EvaluateBezierN(const Vector2 P[], int degree, double t) {
+    if (degree < 0 || degree > BEZIER_MAX_DEGREE) return Vector2();
+    Vector2 work[BEZIER_MAX_DEGREE + 1];
+    for (int i = 0; i <= degree; i++) work[i] = P[i];
+    double s = 1 - t;
+    for (int k = degree; k > 0; k--)
+        for (int i = 0; i < k; i++)
+            work[i] = Vector2(s * work[i].x + t * work[i + 1].x, s * work[i].y + t * work[i + 1].y);
+    return work[0];
+}
+
+/*
+ * Splits the curve at t into two curves of the same degree, left covers [0,t] and right [t,1].
+ * left and right need degree+1 points each. Returns false when the degree is not supported.
+ */
+bool SplitBezierN(const Vector2 P[], int degree, double t, Vector2 left[], Vector2 right[]) {
+    if (degree < 0 || degree > BEZIER_MAX_DEGREE) return false;
+    Vector2 work[BEZIER_MAX_DEGREE + 1];
+    for (int i = 0; i <= degree; i++) work[i] = P[i];
+    double s = 1 - t;
+    left[0] = work[0];
+    right[degree] = work[degree];
+    for (int k = degree; k > 0; k--) {
+        for (int i = 0; i < k; i++)
+            work[i] = Vector2(s * work[i].x + t * work[i + 1].x, s * work[i].y + t * work[i + 1].y);
+        left[degree - k + 1] = work[0];
+        right[k - 1] = work[k - 1];
+    }
+    return true;
+}
+
+/*
+ * Writes the degree+2 control points of the same curve at degree+1:
+ *     Qi = i/(n+1) Pi-1 + (1 - i/(n+1)) Pi
+ * Returns false when the elevated degree is not supported.
+ */
+bool ElevateBezierN(const Vector2 P[], int degree, Vector2 out[]) {
+    if (degree < 0 || degree + 1 > BEZIER_MAX_DEGREE) return false;
+    int n = degree + 1;
+    out[0] = P[0];
+    out[n] = P[degree];
+    for (int i = 1; i < n; i++) {
+        double a = (double)i / n;
+        out[i] = Vector2(a * P[i - 1].x + (1 - a) * P[i].x, a * P[i - 1].y + (1 - a) * P[i].y);
+    }
+    return true;
+}
+
+/*
+ * Writes the degree control points of a curve of degree-1 close to the given one and returns how far apart
+ * the two curves can be (-1 when the degree is not supported).
+ * Inverting the elevation formula from the start (Ri) or from the end (Li) gives two answers that are equal
+ * only when the curve really is of degree-1:
+ *     Ri = (n Pi - i Ri-1) / (n-i)            Li-1 = (n Pi - (n-i) Li) / i
+ * The first half of the points is taken from Ri, the second half from Li, and the middle one is their
+ * average when the count is odd. The returned error is the largest distance between the control points of
+ * the reduced curve elevated back and the original ones, which bounds the distance between the curves.
+ */
+double ReduceBezierN(const Vector2 P[], int degree, Vector2 out[]) {
+    if (degree < 1 || degree > BEZIER_MAX_DEGREE) return -1;
+    int n = degree, m = degree - 1;
+    Vector2 R[BEZIER_MAX_DEGREE + 1], L[BEZIER_MAX_DEGREE + 1];
+    R[0] = P[0];
+    for (int i = 1; i <= m; i++)
+        R[i] = Vector2((n * P[i].x - i * R[i - 1].x) / (n - i), (n * P[i].y - i * R[i - 1].y) / (n - i));
+    L[m] = P[n];
+    for (int i = m; i >= 1; i--)
+        L[i - 1] = Vector2((n * P[i].x - (n - i) * L[i].x) / i, (n * P[i].y - (n - i) * L[i].y) / i);
+    for (int i = 0; i <= m; i++) {
+        if (2 * i < m) out[i] = R[i];
+        else if (2 * i > m) out[i] = L[i];
+        else out[i] = Vector2((R[i].x + L[i].x) / 2, (R[i].y + L[i].y) / 2);
+    }
+    Vector2 back[BEZIER_MAX_DEGREE + 1];
+    ElevateBezierN(out, m, back);
+    double error = 0;
+    for (int i = 0; i <= n; i++)
+        error = std::fmax(error, std::hypot(back[i].x - P[i].x, back[i].y - P[i].y));
+    return error;
+}
+
+/*
+ * A curve is within tolerance of its chord when all its control points are (the curve stays in their convex hull).
+ */
+static bool FlatBezierN(const Vector2 P[], int degree, double tolerance) {
+    double dx = P[degree].x - P[0].x, dy = P[degree].y - P[0].y;
+    double len2 = dx * dx + dy * dy;
+    for (int i = 1; i < degree; i++) {
+        double px = P[i].x - P[0].x, py = P[i].y - P[0].y;
+        double t = len2 > 0 ? (px * dx + py * dy) / len2 : 0;
+        t = t < 0 ? 0 : (t > 1 ? 1 : t);
+        double ex = px - t * dx, ey = py - t * dy;
+        if (ex * ex + ey * ey > tolerance * tolerance) return false;
+    }
+    return true;
+}
+
+static void SubdivideBezierN(const Vector2 P[], int degree, double tolerance, int depth, std::vector<Vector2>& out) {
+    if (depth >= CURVE_MAX_DEPTH || FlatBezierN(P, degree, tolerance)) {
+        out.push_back(P[degree]);
+        return;
+    }
+    Vector2 left[BEZIER_MAX_DEGREE + 1], right[BEZIER_MAX_DEGREE + 1];
+    SplitBezierN(P, degree, 0.5, left, right);
+    SubdivideBezierN(left, degree, tolerance, depth + 1, out);
+    SubdivideBezierN(right, degree, tolerance, depth + 1, out);
+}
+
+/*
+ * Appends the polyline of a curve of any supported degree that stays within tolerance pixels of the curve,
+ * like TessellateBezier for cubics. P0 is only appended when out is empty.
+ */
+void TessellateBezierN(const Vector2 P[], int degree, double tolerance, std::vector<Vector2>& out) {
+    if (degree < 1 || degree > BEZIER_MAX_DEGREE) return;
+    if (out.empty()) out.push_back(P[0]);
+    if (tolerance <= 0) tolerance = 0.25;
+    SubdivideBezierN(P, degree, tolerance, 0, out);
+}
+
+/*
+ * Draws a Bezier curve of any supported degree (quadratic, quintic, ...) as a connected polyline.
+ */
+void DrawBezierCurveN(HDC hdc, const Vector2 P[], int degree, double tolerance, COLORREF color) {
+    std::vector<Vector2> points;
+    TessellateBezierN(P, degree, tolerance, points);
+    DrawPolyline(hdc, points, color);
+}
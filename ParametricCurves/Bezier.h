@@ -0,0 +1,23 @@
+#ifndef PARAMETRICCURVES_BEZIER_H
+#define PARAMETRICCURVES_BEZIER_H
+
+#include <vector>
+#include "Curves.h"
+
+/*
+ * Highest supported degree, every scratch buffer is an array of BEZIER_MAX_DEGREE+1 points on the stack so
+ * no function here allocates.
+ */
+#define BEZIER_MAX_DEGREE 15
+
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+Vector2 EvaluateBezierN(const Vector2 P[], int degree, double t);
+bool SplitBezierN(const Vector2 P[], int degree, double t, Vector2 left[], Vector2 right[]);
+bool ElevateBezierN(const Vector2 P[], int degree, Vector2 out[]);
+double ReduceBezierN(const Vector2 P[], int degree, Vector2 out[]);
+void TessellateBezierN(const Vector2 P[], int degree, double tolerance, std::vector<Vector2>& out);
+void DrawBezierCurveN(HDC hdc, const Vector2 P[], int degree, double tolerance, COLORREF color);
+
+#endif //PARAMETRICCURVES_BEZIER_H
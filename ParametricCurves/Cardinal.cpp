@@ -0,0 +1,95 @@
+#include "Cardinal.h"
+#include <algorithm>
+#include <cstdint>
+#include "Parallel.h"
+
+/*
+ * Number of Hermite segments of a spline through n points, 0 when there are too few points.
+ */
+int CardinalSegmentCount(int n, SplineEnds ends) {
+    switch (ends) {
+        case SPLINE_OPEN: return n >= 4 ? n - 3 : 0;
+        case SPLINE_CLAMPED: return n >= 2 ? n - 1 : 0;
+        default: return n >= 3 ? n : 0;
+    }
+}
+
+/*
+ * Point i of the spline with the phantom end points of the clamped spline and the wrap around of the closed one.
+ */
+static Vector2 SplinePoint(const Vector2 P[], int n, SplineEnds ends, int i) {
+    if (ends == SPLINE_CLOSED) return P[((i % n) + n) % n];
+    if (i < 0) return Vector2(2 * P[0].x - P[1].x, 2 * P[0].y - P[1].y);
+    if (i >= n) return Vector2(2 * P[n - 1].x - P[n - 2].x, 2 * P[n - 1].y - P[n - 2].y);
+    return P[i];
+}
+
+/*
+ * End points and tangents Ti=(1-c)(Pi+1-Pi-1) of one segment, segments are numbered from 0.
+ */
+void CardinalSegment(const Vector2 P[], int n, double tension, SplineEnds ends, int segment, Vector2& Point1, Vector2& Tangential_Point1, Vector2& Point2, Vector2& Tangential_Point2) {
+    double c = 1 - tension;
+    int i = ends == SPLINE_OPEN ? segment + 1 : segment;
+    Vector2 before = SplinePoint(P, n, ends, i - 1), after = SplinePoint(P, n, ends, i + 2);
+    Point1 = SplinePoint(P, n, ends, i);
+    Point2 = SplinePoint(P, n, ends, i + 1);
+    Tangential_Point1 = Vector2(c * (Point2.x - before.x), c * (Point2.y - before.y));
+    Tangential_Point2 = Vector2(c * (after.x - Point1.x), c * (after.y - Point1.y));
+}
+
+/*
+ * Size of the output of EvaluateCardinalSpline: samplesPerSegment points per segment plus the end point.
+ * Computed in 64 bits, 0 when there is nothing to sample or the buffer would not fit in memory.
+ */
+size_t CardinalPointCount(int n, SplineEnds ends, int samplesPerSegment) {
+    int segments = CardinalSegmentCount(n, ends);
+    if (segments == 0 || samplesPerSegment < 1) return 0;
+    unsigned long long count = (unsigned long long)segments * samplesPerSegment + 1;
+    if (count > SIZE_MAX / sizeof(Vector2)) return 0;
+    return (size_t)count;
+}
+
+/*
+ * Samples every segment of the spline into out, which must hold CardinalPointCount points: segment s writes
+ * its samples at t = k/samplesPerSegment, k = 0..samplesPerSegment-1, to out[s*samplesPerSegment+k] with
+ * forward differencing, and the last entry is the end of the spline. The segments only depend on the input
+ * points, so workers take chunks of CARDINAL_CHUNK segments and write disjoint parts of out.
+ */
+void EvaluateCardinalSpline(const Vector2 P[], int n, double tension, SplineEnds ends, int samplesPerSegment, Vector2 out[], int threads) {
+    if (CardinalPointCount(n, ends, samplesPerSegment) == 0) return;
+    int segments = CardinalSegmentCount(n, ends);
+    int chunks = (segments + CARDINAL_CHUNK - 1) / CARDINAL_CHUNK;
+    double h = 1.0 / samplesPerSegment;
+
+    ParallelFor(chunks, threads, [&](int chunk) {
+        int end = std::min(segments, (chunk + 1) * CARDINAL_CHUNK);
+        for (int s = chunk * CARDINAL_CHUNK; s < end; s++) {
+            Vector2 P1, T1, P2, T2;
+            CardinalSegment(P, n, tension, ends, s, P1, T1, P2, T2);
+            Vector4 Xcoeff = GetHermiteCoeff(P1.x, T1.x, P2.x, T2.x);
+            Vector4 Ycoeff = GetHermiteCoeff(P1.y, T1.y, P2.y, T2.y);
+            CubicStepper X = MakeCubicStepper(Xcoeff, h);
+            CubicStepper Y = MakeCubicStepper(Ycoeff, h);
+            Vector2* dst = out + (size_t)s * samplesPerSegment;
+            for (int k = 0; k < samplesPerSegment; k++) {
+                dst[k] = Vector2(X.f, Y.f);
+                X.f += X.d1; X.d1 += X.d2; X.d2 += X.d3;
+                Y.f += Y.d1; Y.d1 += Y.d2; Y.d2 += Y.d3;
+            }
+        }
+    });
+
+    Vector2 P1, T1, P2, T2;
+    CardinalSegment(P, n, tension, ends, segments - 1, P1, T1, P2, T2);
+    out[(size_t)segments * samplesPerSegment] = P2;
+}
+
+/*
+ * Draws an open, clamped or closed cardinal spline as one connected polyline.
+ */
+void DrawCardinalSplineEnds(HDC hdc, Vector2 P[], int n, double tension, SplineEnds ends, int samplesPerSegment, COLORREF color) {
+    std::vector<Vector2> points(CardinalPointCount(n, ends, samplesPerSegment));
+    if (points.empty()) return;
+    EvaluateCardinalSpline(P, n, tension, ends, samplesPerSegment, points.data());
+    DrawPolyline(hdc, points, color);
+}
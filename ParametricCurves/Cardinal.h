@@ -0,0 +1,32 @@
+#ifndef PARAMETRICCURVES_CARDINAL_H
+#define PARAMETRICCURVES_CARDINAL_H
+
+#include <vector>
+#include "Curves.h"
+
+/*
+ * Number of segments a worker of EvaluateCardinalSpline takes at a time.
+ */
+#define CARDINAL_CHUNK 4096
+
+/*
+ * How the ends of a cardinal spline through P0..Pn-1 are handled:
+ * SPLINE_OPEN     like DrawCardinalSpline, only P1..Pn-2 are joined (n-3 segments) since P0 and Pn-1 have no tangent
+ * SPLINE_CLAMPED  phantom points P-1 = 2 P0 - P1 and Pn = 2 Pn-1 - Pn-2 give the end tangents, all n-1 segments
+ * SPLINE_CLOSED   the points wrap around and Pn-1 is joined back to P0, n segments
+ */
+enum SplineEnds {
+    SPLINE_OPEN,
+    SPLINE_CLAMPED,
+    SPLINE_CLOSED
+};
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+int CardinalSegmentCount(int n, SplineEnds ends);
+void CardinalSegment(const Vector2 P[], int n, double tension, SplineEnds ends, int segment, Vector2& Point1, Vector2& Tangential_Point1, Vector2& Point2, Vector2& Tangential_Point2);
+size_t CardinalPointCount(int n, SplineEnds ends, int samplesPerSegment);
+void EvaluateCardinalSpline(const Vector2 P[], int n, double tension, SplineEnds ends, int samplesPerSegment, Vector2 out[], int threads = 0);
+void DrawCardinalSplineEnds(HDC hdc, Vector2 P[], int n, double tension, SplineEnds ends, int samplesPerSegment, COLORREF color);
+
+#endif //PARAMETRICCURVES_CARDINAL_H
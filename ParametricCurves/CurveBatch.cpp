@@ -0,0 +1,105 @@
+#include "CurveBatch.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define CURVE_BATCH_AVX 1
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define CURVE_BATCH_SSE 1
+#endif
+
+/*
+ * Appends one curve with its power basis coefficients, a new block of CURVE_BATCH_LANES zero curves is
+ * started when the padded arrays are full.
+ */
+static void AddCoefficients(CubicBatch& batch, double a[2], double b[2], double c[2], double d[2]) {
+    if (batch.count == batch.Stride()) {
+        size_t size = batch.ax.size() + CURVE_BATCH_LANES;
+        batch.ax.resize(size); batch.bx.resize(size); batch.cx.resize(size); batch.dx.resize(size);
+        batch.ay.resize(size); batch.by.resize(size); batch.cy.resize(size); batch.dy.resize(size);
+    }
+    int i = batch.count++;
+    batch.ax[i] = (float)a[0]; batch.bx[i] = (float)b[0]; batch.cx[i] = (float)c[0]; batch.dx[i] = (float)d[0];
+    batch.ay[i] = (float)a[1]; batch.by[i] = (float)b[1]; batch.cy[i] = (float)c[1]; batch.dy[i] = (float)d[1];
+}
+
+/*
+ * Adds a Hermite curve, the coefficients are the Hermite basis (see GetHermiteCoeff) applied to (x1,u1,x2,u2).
+ */
+void AddHermite(CubicBatch& batch, Vector2& Point1, Vector2& Tangential_Point1, Vector2& Point2, Vector2& Tangential_Point2) {
+    double p1[2] = {Point1.x, Point1.y}, u1[2] = {Tangential_Point1.x, Tangential_Point1.y};
+    double p2[2] = {Point2.x, Point2.y}, u2[2] = {Tangential_Point2.x, Tangential_Point2.y};
+    double a[2], b[2], c[2], d[2];
+    for (int k = 0; k < 2; k++) {
+        a[k] = 2 * p1[k] + u1[k] - 2 * p2[k] + u2[k];
+        b[k] = -3 * p1[k] - 2 * u1[k] + 3 * p2[k] - u2[k];
+        c[k] = u1[k];
+        d[k] = p1[k];
+    }
+    AddCoefficients(batch, a, b, c, d);
+}
+
+/*
+ * Adds a cubic Bezier curve with the Bernstein polynomials expanded to the power basis.
+ */
+void AddBezier(CubicBatch& batch, Vector2& P0, Vector2& P1, Vector2& P2, Vector2& P3) {
+    double q0[2] = {P0.x, P0.y}, q1[2] = {P1.x, P1.y}, q2[2] = {P2.x, P2.y}, q3[2] = {P3.x, P3.y};
+    double a[2], b[2], c[2], d[2];
+    for (int k = 0; k < 2; k++) {
+        a[k] = -q0[k] + 3 * q1[k] - 3 * q2[k] + q3[k];
+        b[k] = 3 * q0[k] - 6 * q1[k] + 3 * q2[k];
+        c[k] = -3 * q0[k] + 3 * q1[k];
+        d[k] = q0[k];
+    }
+    AddCoefficients(batch, a, b, c, d);
+}
+
+/*
+ * Evaluates every curve of the batch at t = s/(samples-1) for s = 0..samples-1 with Horner's rule.
+ * The curves are taken CURVE_BATCH_LANES at a time with their coefficients kept in registers, and for each
+ * sample one t is broadcast to all lanes, so one multiply-add chain gives a sample of 8 curves.
+ * Sample s of curve c is written to x[s*Stride()+c], y[s*Stride()+c]; x and y need samples*Stride() floats.
+ */
+void EvaluateBatch(const CubicBatch& batch, int samples, float x[], float y[]) {
+    if (samples < 2) return;
+    int stride = batch.Stride();
+    float h = 1.0f / (samples - 1);
+    for (int c = 0; c < stride; c += CURVE_BATCH_LANES) {
+#if defined(CURVE_BATCH_AVX)
+        __m256 ax = _mm256_loadu_ps(&batch.ax[c]), bx = _mm256_loadu_ps(&batch.bx[c]);
+        __m256 cx = _mm256_loadu_ps(&batch.cx[c]), dx = _mm256_loadu_ps(&batch.dx[c]);
+        __m256 ay = _mm256_loadu_ps(&batch.ay[c]), by = _mm256_loadu_ps(&batch.by[c]);
+        __m256 cy = _mm256_loadu_ps(&batch.cy[c]), dy = _mm256_loadu_ps(&batch.dy[c]);
+        for (int s = 0; s < samples; s++) {
+            __m256 t = _mm256_set1_ps(s == samples - 1 ? 1.0f : s * h);
+            __m256 vx = _mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(ax, t), bx), t), cx), t), dx);
+            __m256 vy = _mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(ay, t), by), t), cy), t), dy);
+            _mm256_storeu_ps(&x[(size_t)s * stride + c], vx);
+            _mm256_storeu_ps(&y[(size_t)s * stride + c], vy);
+        }
+#elif defined(CURVE_BATCH_SSE)
+        for (int half = 0; half < CURVE_BATCH_LANES; half += 4) {
+            int i = c + half;
+            __m128 ax = _mm_loadu_ps(&batch.ax[i]), bx = _mm_loadu_ps(&batch.bx[i]);
+            __m128 cx = _mm_loadu_ps(&batch.cx[i]), dx = _mm_loadu_ps(&batch.dx[i]);
+            __m128 ay = _mm_loadu_ps(&batch.ay[i]), by = _mm_loadu_ps(&batch.by[i]);
+            __m128 cy = _mm_loadu_ps(&batch.cy[i]), dy = _mm_loadu_ps(&batch.dy[i]);
+            for (int s = 0; s < samples; s++) {
+                __m128 t = _mm_set1_ps(s == samples - 1 ? 1.0f : s * h);
+                __m128 vx = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(ax, t), bx), t), cx), t), dx);
+                __m128 vy = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(ay, t), by), t), cy), t), dy);
+                _mm_storeu_ps(&x[(size_t)s * stride + i], vx);
+                _mm_storeu_ps(&y[(size_t)s * stride + i], vy);
+            }
+        }
+#else
+        for (int s = 0; s < samples; s++) {
+            float t = s == samples - 1 ? 1.0f : s * h;
+            for (int i = c; i < c + CURVE_BATCH_LANES; i++) {
+                x[(size_t)s * stride + i] = ((batch.ax[i] * t + batch.bx[i]) * t + batch.cx[i]) * t + batch.dx[i];
+                y[(size_t)s * stride + i] = ((batch.ay[i] * t + batch.by[i]) * t + batch.cy[i]) * t + batch.dy[i];
+            }
+        }
+#endif
+    }
+}
@@ -0,0 +1,34 @@
+#ifndef PARAMETRICCURVES_CURVEBATCH_H
+#define PARAMETRICCURVES_CURVEBATCH_H
+
+#include <vector>
+#include "Curves.h"
+
+/*
+ * Number of curves evaluated together, the coefficient arrays are padded to a multiple of it so every
+ * SIMD register is full (8 floats with AVX, two registers of 4 with SSE).
+ */
+#define CURVE_BATCH_LANES 8
+
+/*
+ * Many cubic curves stored as structure of arrays: curve i is
+ *   x(t) = ax[i] t^3 + bx[i] t^2 + cx[i] t + dx[i]
+ *   y(t) = ay[i] t^3 + by[i] t^2 + cy[i] t + dy[i]
+ * The coefficients are computed once when a curve is added, so evaluation needs no basis matrix.
+ * Floats are used so twice as many curves fit in a register as with doubles.
+ */
+struct CubicBatch {
+    int count = 0;
+    std::vector<float> ax, bx, cx, dx;
+    std::vector<float> ay, by, cy, dy;
+    /* distance between two samples of the same curve in the output of EvaluateBatch */
+    int Stride() const { return (int)ax.size(); }
+};
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+void AddHermite(CubicBatch& batch, Vector2& Point1, Vector2& Tangential_Point1, Vector2& Point2, Vector2& Tangential_Point2);
+void AddBezier(CubicBatch& batch, Vector2& P0, Vector2& P1, Vector2& P2, Vector2& P3);
+void EvaluateBatch(const CubicBatch& batch, int samples, float x[], float y[]);
+
+#endif //PARAMETRICCURVES_CURVEBATCH_H
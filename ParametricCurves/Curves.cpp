@@ -0,0 +1,319 @@
+#include "Curves.h"
+#include <cstdlib>
+#include <cstring>
+
+int Round( double num){
+    return num+0.5;
+}
+
+/*
+ * Hash of the bit patterns of n doubles for the curve caches. -0.0 is hashed as +0.0 because the cache keys
+ * compare their values and find them equal (tension 1 or negated zero tangents give -0.0).
+ */
+size_t HashDoubles(const double v[], size_t n, unsigned long long seed) {
+    unsigned long long h = 1469598103934665603ULL ^ seed;
+    for (size_t i = 0; i < n; i++) {
+        double value = v[i] == 0 ? 0.0 : v[i];
+        unsigned long long bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        h = (h ^ bits) * 1099511628211ULL;
+        h ^= h >> 29;
+    }
+    return (size_t)h;
+}
+/*
+ * Draws a Hermite curve on the specified device context (hdc) based on the given control points and tangents.
+ * The Hermite curve is a smooth interpolation between the control points Point1 and Point2.
+ * Additionally, the tangents Tangential_Point1 and Tangential_Point2 influence the direction of the curve at each control point.
+ * The curve is drawn with the specified color.
+ * */
+
+void DrawHermiteCurve(HDC hdc,Vector2& Point1, Vector2& Tangential_Point1,Vector2& Point2, Vector2& Tangential_Point2,int numOfPoints, COLORREF color ){
+    /* Calculate Hermite coefficients for x and y coordinates based on the given control points and tangents (x1,u1,x2,u2) and (y1,v1,y2,v2) */
+    Vector4 Xcoeff=GetHermiteCoeff(Point1.x,Tangential_Point1.x,Point2.x,Tangential_Point2.x);
+    Vector4 Ycoeff=GetHermiteCoeff(Point1.y,Tangential_Point1.y,Point2.y,Tangential_Point2.y);
+    /* Return if the number of points to interpolate is less than 2 */
+    if(numOfPoints<2)return;
+    /* Calculate the step size between each interpolated point */
+    double dt=1.0/(numOfPoints-1);
+    for(double t=0;t<=1;t+=dt)
+    {
+        Vector4 vt;
+        /*The fourth component of vt is set to 1 (vt[3]=1)
+         *setting vt[3] to 1 effectively treats the resulting vector as a point in 3D space,*/
+        vt[3]=1;
+        /*
+         * A loop is used to calculate the values of the first three
+         * components of vt based on the current parameter t and the Hermite basis functions.
+         * it Computes the point on the curve using Hermite basis functions and coefficients
+         * The Hermite basis functions are used to interpolate the curve smoothly between control points
+         * */
+        for(int i=2;i>=0;i--){
+            vt[i]=vt[i+1]*t;
+        }
+        /* Calculate the x and y coordinates of the point on the curve by
+         * taking the dot product with the Hermite coefficients */
+        int x=Round(DotProduct(Xcoeff,vt));
+        int y=Round(DotProduct(Ycoeff,vt));
+        SetPixel(hdc,x,y,color);
+    }
+
+}
+
+/*
+ * Sets up forward differencing of a cubic with coefficients (a,b,c,d) as returned by GetHermiteCoeff.
+ * The cubic is exact at every step: the third difference of a cubic is constant, so
+ *   f(t+h) = f(t) + d1, d1 += d2, d2 += d3
+ * walks the samples with three additions and no powers of t.
+ */
+CubicStepper MakeCubicStepper(const Vector4& coeff, double h) {
+    double a = coeff[0], b = coeff[1], c = coeff[2], d = coeff[3];
+    double h2 = h * h, h3 = h2 * h;
+    CubicStepper s;
+    s.f = d;
+    s.d1 = a * h3 + b * h2 + c * h;
+    s.d2 = 6 * a * h3 + 2 * b * h2;
+    s.d3 = 6 * a * h3;
+    return s;
+}
+
+/*
+ * Writes numOfPoints samples of the cubic (Xcoeff,Ycoeff) at t = i/(numOfPoints-1) into out using forward differencing.
+ * The count is exact (an integer loop instead of t += dt) and the last point is the exact end point t=1,
+ * so rounding in the additions can never drop or move the end of the curve.
+ */
+void HermiteForwardPoints(const Vector4& Xcoeff, const Vector4& Ycoeff, int numOfPoints, Vector2 out[]) {
+    if (numOfPoints < 2) return;
+    double h = 1.0 / (numOfPoints - 1);
+    CubicStepper X = MakeCubicStepper(Xcoeff, h);
+    CubicStepper Y = MakeCubicStepper(Ycoeff, h);
+    for (int i = 0; i < numOfPoints - 1; i++) {
+        out[i] = Vector2(X.f, Y.f);
+        X.f += X.d1; X.d1 += X.d2; X.d2 += X.d3;
+        Y.f += Y.d1; Y.d1 += Y.d2; Y.d2 += Y.d3;
+    }
+    out[numOfPoints - 1] = Vector2(Xcoeff[0] + Xcoeff[1] + Xcoeff[2] + Xcoeff[3],
+                                   Ycoeff[0] + Ycoeff[1] + Ycoeff[2] + Ycoeff[3]);
+}
+
+/*
+ * Same curve as DrawHermiteCurve but evaluated with forward differencing: after the setup every pixel costs
+ * three additions per axis instead of building the powers of t and two dot products, and exactly
+ * numOfPoints pixels are plotted with the last one at Point2.
+ * */
+void DrawHermiteCurveForward(HDC hdc,Vector2& Point1, Vector2& Tangential_Point1,Vector2& Point2, Vector2& Tangential_Point2,int numOfPoints, COLORREF color ){
+    Vector4 Xcoeff=GetHermiteCoeff(Point1.x,Tangential_Point1.x,Point2.x,Tangential_Point2.x);
+    Vector4 Ycoeff=GetHermiteCoeff(Point1.y,Tangential_Point1.y,Point2.y,Tangential_Point2.y);
+    if(numOfPoints<2)return;
+    double h=1.0/(numOfPoints-1);
+    CubicStepper X=MakeCubicStepper(Xcoeff,h);
+    CubicStepper Y=MakeCubicStepper(Ycoeff,h);
+    for(int i=0;i<numOfPoints-1;i++)
+    {
+        SetPixel(hdc,Round(X.f),Round(Y.f),color);
+        X.f+=X.d1; X.d1+=X.d2; X.d2+=X.d3;
+        Y.f+=Y.d1; Y.d1+=Y.d2; Y.d2+=Y.d3;
+    }
+    SetPixel(hdc,Round(Point2.x),Round(Point2.y),color);
+}
+
+/* Bezier curves are special cases of Hermit curves in which T0 and T1 are computed from four points P0,
+ * P1, P2, P3 as follows: The curve starts at P0 when t=0 and ends at P3 when t=1. This has a geometrical interpretation if we
+ * consider the individual components of the four points for example the x components i.e. x0, x1, x2, x3.
+ * Bezier assumes that x=x0 when t=0, x=x1 when t=1/3, x=x2 when t=2/3 and x=x3 when t=1. So we
+ * have four points in the T-X plane: (0, x0), (1/3, x1), (2/3, x2) and (1, x3).
+ * */
+void DrawBezierCurve(HDC hdc,Vector2& P0,Vector2& P1,Vector2& P2,Vector2& P3,int numpoints ,COLORREF color)
+{
+    Vector2 T0(3*(P1.x-P0.x),3*(P1.y-P0.y));
+    Vector2 T1(3*(P3.x-P2.x),3*(P3.y-P2.y));
+    DrawHermiteCurve(hdc,P0,T0,P3,T1,numpoints,color);
+}
+
+/*
+ * Cardinal splines
+ *   If we are given a set of points Po, P1, P2, ... , Pn, we can draw a curve passing through P1, P2, ... ,Pn-1 by
+ *   calling the Hermite curve drawing algorithm for every interval P(-Pi+1 , i=1,2, .. ,n-2. The slope at P is
+ *   given by:
+ *       Ti=(1-c)(Pi+1-Pi-1)
+ *   c is called the 'tension' of the curve that takes values from 0 to 1. The following function shows the
+ *   implementation of this algorithm. Note that the algorithm does not draw the first and last interval
+ *   because it cannot compute the tangents at these points, Cardinal.h has clamped and closed variants that do.
+ * */
+void DrawCardinalSpline(HDC hdc, Vector2 P[], int n, double tension, int numpix, COLORREF color)
+{
+    if (n < 4) return; // no interval has a tangent at both ends
+    double c = 1 - tension;
+    Vector2 T0(c * (P[2].x - P[0].x), c * (P[2].y - P[0].y));
+    for (int i = 1; i < n - 2; i++)
+    {
+        Vector2 T1(c * (P[i + 2].x - P[i].x), c * (P[i + 2].y - P[i].y)); // tangent at P[i+1]
+        DrawHermiteCurve(hdc, P[i], T0, P[i + 1], T1, numpix, color); // Changed index for P[i] and P[i+1]
+        T0 = T1;
+    }
+}
+
+/* Adaptive tessellation
+ * A cubic Bezier is flat enough to be drawn as the line P0-P3 when its two inner control points are close to
+ * the points at 1/3 and 2/3 of the chord. The distance of the curve from the chord is at most
+ *     3/4 * max(|3 P1 - 2 P0 - P3|, |3 P2 - P0 - 2 P3|) / 3
+ * so comparing the squared lengths with 16 tolerance^2 needs no square root. A curve that is not flat is split
+ * at t=1/2 by de Casteljau and both halves are tested again, so the number of lines grows with the length and
+ * the bend of the curve on screen and not with a fixed point count.
+ * */
+static void SubdivideBezier(Vector2 P0, Vector2 P1, Vector2 P2, Vector2 P3, double tolerance2, int depth, std::vector<Vector2>& out) {
+    double ux = 3 * P1.x - 2 * P0.x - P3.x, uy = 3 * P1.y - 2 * P0.y - P3.y;
+    double vx = 3 * P2.x - P0.x - 2 * P3.x, vy = 3 * P2.y - P0.y - 2 * P3.y;
+    double u = ux * ux + uy * uy, v = vx * vx + vy * vy;
+    if (depth >= CURVE_MAX_DEPTH || (u > v ? u : v) <= 16 * tolerance2) {
+        out.push_back(P3);
+        return;
+    }
+    /* de Casteljau at t=1/2 */
+    Vector2 P01((P0.x + P1.x) / 2, (P0.y + P1.y) / 2), P12((P1.x + P2.x) / 2, (P1.y + P2.y) / 2), P23((P2.x + P3.x) / 2, (P2.y + P3.y) / 2);
+    Vector2 P012((P01.x + P12.x) / 2, (P01.y + P12.y) / 2), P123((P12.x + P23.x) / 2, (P12.y + P23.y) / 2);
+    Vector2 M((P012.x + P123.x) / 2, (P012.y + P123.y) / 2);
+    SubdivideBezier(P0, P01, P012, M, tolerance2, depth + 1, out);
+    SubdivideBezier(M, P123, P23, P3, tolerance2, depth + 1, out);
+}
+
+/*
+ * Appends the polyline of a cubic Bezier that stays within tolerance pixels of the curve to out.
+ * P0 is only appended when out is empty, so consecutive curves share their joint point.
+ */
+void TessellateBezier(Vector2 P0, Vector2 P1, Vector2 P2, Vector2 P3, double tolerance, std::vector<Vector2>& out) {
+    if (out.empty()) out.push_back(P0);
+    if (tolerance <= 0) tolerance = 0.25;
+    SubdivideBezier(P0, P1, P2, P3, tolerance * tolerance, 0, out);
+}
+
+/*
+ * Appends the polyline of a Hermite curve, the Hermite curve is the Bezier with
+ * P1 = Point1 + T1/3 and P2 = Point2 - T2/3 (the inverse of the conversion in DrawBezierCurve).
+ */
+void TessellateHermite(Vector2& Point1, Vector2& Tangential_Point1, Vector2& Point2, Vector2& Tangential_Point2, double tolerance, std::vector<Vector2>& out) {
+    Vector2 B1(Point1.x + Tangential_Point1.x / 3, Point1.y + Tangential_Point1.y / 3);
+    Vector2 B2(Point2.x - Tangential_Point2.x / 3, Point2.y - Tangential_Point2.y / 3);
+    TessellateBezier(Point1, B1, B2, Point2, tolerance, out);
+}
+
+/*
+ * Integer Bresenham line from (x1,y1) to (x2,y2) in every octant, only additions and compares per pixel.
+ * With skipFirst the first pixel is not drawn so the lines of a polyline do not plot their joints twice.
+ */
+void DrawLineBresenham(HDC hdc, int x1, int y1, int x2, int y2, COLORREF color, bool skipFirst) {
+    int dx = abs(x2 - x1), dy = -abs(y2 - y1);
+    int sx = x1 < x2 ? 1 : -1, sy = y1 < y2 ? 1 : -1;
+    int err = dx + dy;
+    if (!skipFirst) SetPixel(hdc, x1, y1, color);
+    while (x1 != x2 || y1 != y2) {
+        int e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x1 += sx; }
+        if (e2 <= dx) { err += dx; y1 += sy; }
+        SetPixel(hdc, x1, y1, color);
+    }
+}
+
+/*
+ * Draws the lines of a polyline as one connected 8-connected path, every pixel once.
+ */
+void DrawPolyline(HDC hdc, const std::vector<Vector2>& points, COLORREF color) {
+    if (points.empty()) return;
+    int x = Round(points[0].x), y = Round(points[0].y);
+    SetPixel(hdc, x, y, color);
+    for (size_t i = 1; i < points.size(); i++) {
+        int nx = Round(points[i].x), ny = Round(points[i].y);
+        if (nx == x && ny == y) continue;
+        DrawLineBresenham(hdc, x, y, nx, ny, color, true);
+        x = nx;
+        y = ny;
+    }
+}
+
+/*
+ * Hermite curve drawn as a connected polyline that stays within tolerance pixels of the curve.
+ */
+void DrawHermiteCurveAdaptive(HDC hdc,Vector2& Point1, Vector2& Tangential_Point1,Vector2& Point2, Vector2& Tangential_Point2,double tolerance, COLORREF color ){
+    std::vector<Vector2> points;
+    TessellateHermite(Point1, Tangential_Point1, Point2, Tangential_Point2, tolerance, points);
+    DrawPolyline(hdc, points, color);
+}
+
+/*
+ * Bezier curve drawn as a connected polyline, the control points are used directly without the Hermite conversion.
+ */
+void DrawBezierCurveAdaptive(HDC hdc,Vector2& P0,Vector2& P1,Vector2& P2,Vector2& P3,double tolerance ,COLORREF color){
+    std::vector<Vector2> points;
+    TessellateBezier(P0, P1, P2, P3, tolerance, points);
+    DrawPolyline(hdc, points, color);
+}
+
+/*
+ * Appends the polyline of a cardinal spline over the same intervals as DrawCardinalSpline, nothing when n < 4.
+ */
+void TessellateCardinalSpline(Vector2 P[], int n, double tension, double tolerance, std::vector<Vector2>& out)
+{
+    /* the first and last intervals are skipped, so at least 4 points are needed for one interval */
+    if (n < 4) return;
+    double c = 1 - tension;
+    Vector2 T0(c * (P[2].x - P[0].x), c * (P[2].y - P[0].y));
+    for (int i = 1; i < n - 2; i++)
+    {
+        Vector2 T1(c * (P[i + 2].x - P[i].x), c * (P[i + 2].y - P[i].y));
+        TessellateHermite(P[i], T0, P[i + 1], T1, tolerance, out);
+        T0 = T1;
+    }
+}
+
+/*
+ * Cardinal spline over the same intervals as DrawCardinalSpline drawn as one connected polyline.
+ */
+void DrawCardinalSplineAdaptive(HDC hdc, Vector2 P[], int n, double tension, double tolerance, COLORREF color)
+{
+    std::vector<Vector2> points;
+    TessellateCardinalSpline(P, n, tension, tolerance, points);
+    DrawPolyline(hdc, points, color);
+}
+
+/* parametric cubic curves
+ * A third order (cubic) parametric curve is given by:
+ *
+ * x(t)= alpha0 + alpha1 t+ alpha2 t^2 + alpha3 t^3
+ * y(t)= beta0 + beta1 t+ beta2 t^2 + beta3 t^3
+ *
+ * dy/dt= alpha1 + 2 alpha2 t + 3 alpha3 t^2
+ * dy/dt= beta1 + 2 beta2 t + 3 beta3 t^2
+* */
+
+/* Hermite Curve
+ * constraints
+ *   1-curve passes through (x1,y1) at t=0
+ *   x(0)=x1 y(0)=y1
+ *   2-Derivative of the curve at t=0 (u1,v1)
+ *   x(0)=u1 y(0)=v1
+ *   3-curve passes through (x2,y2) at t=1
+ *   x(1)=x2 y(1)=y2
+ *   4-Derivative of the curve at t=1 (u2,v2)
+ *   x(1)=u2 y(1)=v2
+ *
+ *  constraints on x
+ *   x(0)=x1 -> alpha0=x1
+ *   dx/dt(0) ->alpha1=u1
+ *   x(1)=x2 -> alpha0 + alpha1 + alpha2  + alpha3 =x2 ->
+ *   alpha2 + alpha3 = x2-x1-u1 eq1
+ *   dx/dt(1) ->alpha1 + 2alpha2  + 3alpha3=u2 ->
+ *   dx/dt(1) ->alpha1 + 2alpha2  + 3alpha3=u2 ->
+ *   2alpha2  + 3alpha3 = u2-u1 eq2
+
+ *   solving 2 equ together
+ *   [alpha0      [1  0 0  0    [x1
+ *   alpha1    =  0  1 0  0     u1
+ *    alpha2      -3 -2 3 -1     x2
+ *   alpha3]      2  1 -2 1]    u2]
+
+ *  similar at y constraints
+
+ *  Each column in the matrix represents a vector of coefficients corresponding to
+ *  each term in your polynomial equation, we need to implement vector class and matrix class
+ *  implementing the matrix class for enabling operations like multiplying four vectors together,
+*/
\ No newline at end of file
@@ -0,0 +1,70 @@
+#ifndef PARAMETRICCURVES_CURVES_H
+#define PARAMETRICCURVES_CURVES_H
+
+#include <Windows.h>
+#include <vector>
+#include "Matrix.h"
+
+/*
+ * 2D vector structure for representing points (x,y).
+ */
+struct Vector2 {
+    double x, y;
+    Vector2(double a = 0, double b = 0) : x(a), y(b) {}
+};
+
+/*
+ * 4D vector for the cubic coefficients and 4x4 matrix for the bases, see Matrix.h.
+ */
+typedef Vec<double, 4> Vector4;
+typedef Mat<double, 4, 4> Matrix4;
+
+/*
+ * Forward differences of one axis of a cubic a t^3 + b t^2 + c t + d sampled every h:
+ * f is the current value and d1, d2, d3 its first, second and third differences.
+ */
+struct CubicStepper {
+    double f, d1, d2, d3;
+};
+/*
+ * Maximum subdivision depth of the adaptive tessellation, a cubic is never split in more than 2^depth lines.
+ */
+#define CURVE_MAX_DEPTH 16
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+constexpr double DotProduct(const Vector4& a, const Vector4& b);
+constexpr Vector4 GetHermiteCoeff(double x1,double u1,double x2,double u2);
+int Round( double num);
+size_t HashDoubles(const double v[], size_t n, unsigned long long seed);
+void DrawHermiteCurve(HDC hdc,Vector2& Point1, Vector2& Tangential_Point1,Vector2& Point2, Vector2& Tangential_Point2,int numOfPoints, COLORREF color );
+void DrawBezierCurve(HDC hdc,Vector2& P0,Vector2& P1,Vector2& P2,Vector2& P3,int numpoints ,COLORREF color);
+void DrawCardinalSpline(HDC hdc, Vector2 P[], int n, double tension, int numpix, COLORREF color);
+CubicStepper MakeCubicStepper(const Vector4& coeff, double h);
+void HermiteForwardPoints(const Vector4& Xcoeff, const Vector4& Ycoeff, int numOfPoints, Vector2 out[]);
+void DrawHermiteCurveForward(HDC hdc,Vector2& Point1, Vector2& Tangential_Point1,Vector2& Point2, Vector2& Tangential_Point2,int numOfPoints, COLORREF color );
+void TessellateBezier(Vector2 P0, Vector2 P1, Vector2 P2, Vector2 P3, double tolerance, std::vector<Vector2>& out);
+void TessellateHermite(Vector2& Point1, Vector2& Tangential_Point1, Vector2& Point2, Vector2& Tangential_Point2, double tolerance, std::vector<Vector2>& out);
+void TessellateCardinalSpline(Vector2 P[], int n, double tension, double tolerance, std::vector<Vector2>& out);
+void DrawLineBresenham(HDC hdc, int x1, int y1, int x2, int y2, COLORREF color, bool skipFirst);
+void DrawPolyline(HDC hdc, const std::vector<Vector2>& points, COLORREF color);
+void DrawHermiteCurveAdaptive(HDC hdc,Vector2& Point1, Vector2& Tangential_Point1,Vector2& Point2, Vector2& Tangential_Point2,double tolerance, COLORREF color );
+void DrawBezierCurveAdaptive(HDC hdc,Vector2& P0,Vector2& P1,Vector2& P2,Vector2& P3,double tolerance ,COLORREF color);
+void DrawCardinalSplineAdaptive(HDC hdc, Vector2 P[], int n, double tension, double tolerance, COLORREF color);
+
+/*
+ * Computes the dot product of two 4D vectors.
+ */
+constexpr double DotProduct(const Vector4& a, const Vector4& b) {
+    return Dot(a, b);
+}
+
+/*
+ * Computes Hermite coefficients based on given control points and tangents, the basis is a compile time constant.
+ */
+constexpr Vector4 GetHermiteCoeff(double x1,double u1,double x2,double u2)
+{
+    return HermiteBasis<double>*Vector4(x1,u1,x2,u2);
+}
+
+#endif //PARAMETRICCURVES_CURVES_H
@@ -0,0 +1,158 @@
+#ifndef PARAMETRICCURVES_MATRIX_H
+#define PARAMETRICCURVES_MATRIX_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Fixed size vector of N values of type T.
+ * It is a plain value type (trivially copyable, no heap) and every operation is constexpr, so vectors can be
+ * built and multiplied at compile time. A default constructed vector is all zeros.
+ */
+template<typename T, int N>
+struct Vec {
+    T v[N];
+
+    constexpr Vec() : v{} {}
+    /* one value per component, Vec<double,4> v(x1,u1,x2,u2) */
+    template<typename... A, typename = std::enable_if_t<sizeof...(A) == N && N != 1>>
+    constexpr Vec(A... a) : v{T(a)...} {}
+    /* copy N values from an array, explicit so Vec v = 0 does not read through a null pointer */
+    explicit constexpr Vec(const T a[]) : v{} {
+        for (int i = 0; i < N; i++) v[i] = a[i];
+    }
+
+    constexpr T& operator[](int i) { return v[i]; }
+    constexpr const T& operator[](int i) const { return v[i]; }
+    static constexpr int size() { return N; }
+};
+
+/*
+ * Fixed size R x C matrix stored as R row vectors. Like Vec it is a constexpr value type, a default
+ * constructed matrix is all zeros.
+ */
+template<typename T, int R, int C>
+struct Mat {
+    Vec<T, C> M[R];
+
+    constexpr Mat() : M{} {}
+    /* R*C values row by row */
+    template<typename... A, typename = std::enable_if_t<sizeof...(A) == R * C && R * C != 1>>
+    constexpr Mat(A... a) : M{} {
+        const T values[] = {T(a)...};
+        for (int i = 0; i < R; i++)
+            for (int j = 0; j < C; j++)
+                M[i][j] = values[i * C + j];
+    }
+    /* copy R*C values row by row from an array, explicit like the Vec one */
+    explicit constexpr Mat(const T a[]) : M{} {
+        for (int i = 0; i < R; i++)
+            for (int j = 0; j < C; j++)
+                M[i][j] = a[i * C + j];
+    }
+
+    constexpr Vec<T, C>& operator[](int i) { return M[i]; }
+    constexpr const Vec<T, C>& operator[](int i) const { return M[i]; }
+};
+
+
+/*
+ * Matrix-vector product, both operands are taken by const reference so nothing is copied.
+ */
+template<typename T, int R, int C>
+constexpr Vec<T, R> operator*(const Mat<T, R, C>& A, const Vec<T, C>& b) {
+    Vec<T, R> res;
+    for (int i = 0; i < R; i++)
+        res[i] = Dot(A[i], b);
+    return res;
+}
+
+/*
+ * Matrix-matrix product.
+ */
+template<typename T, int R, int K, int C>
+constexpr Mat<T, R, C> operator*(const Mat<T, R, K>& A, const Mat<T, K, C>& B) {
+    Mat<T, R, C> res;
+    for (int i = 0; i < R; i++)
+        for (int j = 0; j < C; j++)
+            for (int k = 0; k < K; k++)
+                res[i][j] += A[i][k] * B[k][j];
+    return res;
+}
+
+template<typename T, int R, int C>
+constexpr Mat<T, C, R> Transpose(const Mat<T, R, C>& A) {
+    Mat<T, C, R> res;
+    for (int i = 0; i < R; i++)
+        for (int j = 0; j < C; j++)
+            res[j][i] = A[i][j];
+    return res;
+}
+
+template<typename T, int N, std::size_t... I>
+constexpr T DotTerms(const Vec<T, N>& a, const Vec<T, N>& b, std::index_sequence<I...>) {
+    return (... + (a.v[I] * b.v[I]));
+}
+
+/*
+ * Dot product written out term by term at compile time (a0*b0 + a1*b1 + ...), so the vectors can stay in
+ * registers instead of being indexed in a loop.
+ */
+template<typename T, int N>
+constexpr T Dot(const Vec<T, N>& a, const Vec<T, N>& b) {
+    return DotTerms(a, b, std::make_index_sequence<N>());
+}
+
+template<typename T, int N>
+constexpr Vec<T, N> operator+(const Vec<T, N>& a, const Vec<T, N>& b) {
+    Vec<T, N> res;
+    for (int i = 0; i < N; i++) res[i] = a[i] + b[i];
+    return res;
+}
+
+template<typename T, int N>
+constexpr Vec<T, N> operator-(const Vec<T, N>& a, const Vec<T, N>& b) {
+    Vec<T, N> res;
+    for (int i = 0; i < N; i++) res[i] = a[i] - b[i];
+    return res;
+}
+
+template<typename T, int N>
+constexpr Vec<T, N> operator*(T s, const Vec<T, N>& a) {
+    Vec<T, N> res;
+    for (int i = 0; i < N; i++) res[i] = s * a[i];
+    return res;
+}
+
+template<typename T, int N>
+constexpr bool operator==(const Vec<T, N>& a, const Vec<T, N>& b) {
+    for (int i = 0; i < N; i++)
+        if (!(a[i] == b[i])) return false;
+    return true;
+}
+
+/*
+ * Hermite basis: multiplied by (x1,u1,x2,u2) it gives the cubic coefficients (alpha3,alpha2,alpha1,alpha0),
+ * see the derivation at the end of Curves.cpp. It is a compile time constant, there is no static to guard.
+ */
+template<typename T>
+inline constexpr Mat<T, 4, 4> HermiteBasis(2, 1, -2, 1,
+                                           -3, -2, 3, -1,
+                                           0, 1, 0, 0,
+                                           1, 0, 0, 0);
+
+/*
+ * Bezier basis: multiplied by (x0,x1,x2,x3) it gives the cubic coefficients (alpha3,alpha2,alpha1,alpha0).
+ */
+template<typename T>
+inline constexpr Mat<T, 4, 4> BezierBasis(-1, 3, -3, 1,
+                                          3, -6, 3, 0,
+                                          -3, 3, 0, 0,
+                                          1, 0, 0, 0);
+
+static_assert(std::is_trivially_copyable<Mat<double, 4, 4>>::value, "matrices are plain values");
+static_assert(!std::is_convertible<int, Vec<double, 4>>::value, "Vec v = 0 must not convert 0 to a pointer");
+static_assert(HermiteBasis<int> * Vec<int, 4>(1, 0, 0, 0) == Vec<int, 4>(2, -3, 0, 1), "Hermite basis is evaluated at compile time");
+
+#endif //PARAMETRICCURVES_MATRIX_H
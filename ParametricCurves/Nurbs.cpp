@@ -0,0 +1,194 @@
+#include "Nurbs.h"
+#include <algorithm>
+
+/* B-splines and NURBS
+ * A B-spline of degree p with control points P0..Pn-1 and knots u0 <= u1 <= ... <= un+p is
+ *     C(u) = sum over j of Nj,p(u) Pj
+ * with the basis functions of Cox - de Boor
+ *     Nj,0(u) = 1 for uj <= u < uj+1, 0 otherwise
+ *     Nj,k(u) = (u - uj)/(uj+k - uj) Nj,k-1(u) + (uj+k+1 - u)/(uj+k+1 - uj+1) Nj+1,k-1(u)
+ * A NURBS curve adds a weight wj per point: the B-spline of the points (wj xj, wj yj, wj) is computed and
+ * x and y are divided by the third coordinate, which draws conics such as circles exactly.
+ * Inside one knot span [ui, ui+1) only Ni-p..Ni are non zero and each is a polynomial of degree p, so the
+ * curve is a polynomial there too.
+ * */
+
+/*
+ * Knots 0,1,2,... : a uniform B-spline, the curve does not reach the first and last control points.
+ */
+void UniformKnots(NurbsCurve& curve) {
+    int count = (int)curve.P.size() + curve.degree + 1;
+    curve.knots.resize(count);
+    for (int i = 0; i < count; i++) curve.knots[i] = i;
+}
+
+/*
+ * Knots repeated degree+1 times at both ends and uniform inside: the curve starts at the first control point
+ * and ends at the last one.
+ */
+void ClampedKnots(NurbsCurve& curve) {
+    int n = (int)curve.P.size(), p = curve.degree;
+    curve.knots.resize(n + p + 1);
+    for (int i = 0; i < n + p + 1; i++)
+        curve.knots[i] = std::min(std::max(i - p, 0), n - p);
+}
+
+/*
+ * True when the degree is supported and the weights and knots match the control points.
+ */
+bool ValidNurbs(const NurbsCurve& curve) {
+    int n = (int)curve.P.size(), p = curve.degree;
+    if (p < 1 || p > NURBS_MAX_DEGREE || n < p + 1) return false;
+    if (!curve.weights.empty() && (int)curve.weights.size() != n) return false;
+    if ((int)curve.knots.size() != n + p + 1) return false;
+    for (int i = 1; i < n + p + 1; i++)
+        if (curve.knots[i] < curve.knots[i - 1]) return false;
+    return curve.knots[p] < curve.knots[n];
+}
+
+/*
+ * Index i of the knot span [ui, ui+1) holding u, found by binary search in [p, n-1]; u at the end of the
+ * curve belongs to the last non empty span.
+ */
+int FindKnotSpan(const NurbsCurve& curve, double u) {
+    int n = (int)curve.P.size(), p = curve.degree;
+    const std::vector<double>& U = curve.knots;
+    if (u >= U[n]) {
+        int i = n - 1;
+        while (i > p && U[i] == U[n]) i--;
+        return i;
+    }
+    if (u <= U[p]) {
+        int i = p;
+        while (i < n - 1 && U[i + 1] == U[p]) i++;
+        return i;
+    }
+    return (int)(std::upper_bound(U.begin() + p, U.begin() + n + 1, u) - U.begin()) - 1;
+}
+
+/*
+ * Point of the curve at u with de Boor's algorithm on the homogeneous points, for single queries.
+ */
+Vector2 EvaluateNurbs(const NurbsCurve& curve, double u) {
+    if (!ValidNurbs(curve)) return Vector2();
+    int p = curve.degree, i = FindKnotSpan(curve, u);
+    const std::vector<double>& U = curve.knots;
+    double x[NURBS_MAX_DEGREE + 1], y[NURBS_MAX_DEGREE + 1], w[NURBS_MAX_DEGREE + 1];
+    for (int j = 0; j <= p; j++) {
+        int k = i - p + j;
+        double wk = curve.weights.empty() ? 1 : curve.weights[k];
+        x[j] = curve.P[k].x * wk;
+        y[j] = curve.P[k].y * wk;
+        w[j] = wk;
+    }
+    for (int r = 1; r <= p; r++)
+        for (int j = p; j >= r; j--) {
+            int k = i - p + j;
+            double a = (u - U[k]) / (U[k + p - r + 1] - U[k]);
+            x[j] = (1 - a) * x[j - 1] + a * x[j];
+            y[j] = (1 - a) * y[j - 1] + a * y[j];
+            w[j] = (1 - a) * w[j - 1] + a * w[j];
+        }
+    return Vector2(x[p] / w[p], y[p] / w[p]);
+}
+
+/*
+ * Coefficients in s = u - ui of the homogeneous curve polynomial inside span i: the basis functions
+ * Ni-p..Ni are built as polynomials with the Cox - de Boor recursion once per span.
+ */
+static void SpanPolynomials(const NurbsCurve& curve, int i, double X[], double Y[], double W[]) {
+    int p = curve.degree;
+    const std::vector<double>& U = curve.knots;
+    /* N[j] holds Ni-k+j,k at level k, coefficient c of s^c at N[j][c] */
+    double N[NURBS_MAX_DEGREE + 2][NURBS_MAX_DEGREE + 1] = {};
+    N[0][0] = 1;
+    for (int k = 1; k <= p; k++) {
+        double next[NURBS_MAX_DEGREE + 2][NURBS_MAX_DEGREE + 1] = {};
+        for (int j = 0; j <= k; j++) {
+            int g = i - k + j;
+            /* (u - ug)/(ug+k - ug) Ng,k-1, where Ng,k-1 is N[j-1] of the previous level */
+            if (j >= 1) {
+                double d = U[g + k] - U[g];
+                if (d > 0)
+                    for (int c = 0; c < k; c++) {
+                        next[j][c] += (U[i] - U[g]) / d * N[j - 1][c];
+                        next[j][c + 1] += N[j - 1][c] / d;
+                    }
+            }
+            /* (ug+k+1 - u)/(ug+k+1 - ug+1) Ng+1,k-1, where Ng+1,k-1 is N[j] of the previous level */
+            if (j <= k - 1) {
+                double d = U[g + k + 1] - U[g + 1];
+                if (d > 0)
+                    for (int c = 0; c < k; c++) {
+                        next[j][c] += (U[g + k + 1] - U[i]) / d * N[j][c];
+                        next[j][c + 1] -= N[j][c] / d;
+                    }
+            }
+        }
+        std::copy(&next[0][0], &next[0][0] + (NURBS_MAX_DEGREE + 2) * (NURBS_MAX_DEGREE + 1), &N[0][0]);
+    }
+    for (int c = 0; c <= p; c++) X[c] = Y[c] = W[c] = 0;
+    for (int j = 0; j <= p; j++) {
+        int k = i - p + j;
+        double wk = curve.weights.empty() ? 1 : curve.weights[k];
+        for (int c = 0; c <= p; c++) {
+            X[c] += N[j][c] * wk * curve.P[k].x;
+            Y[c] += N[j][c] * wk * curve.P[k].y;
+            W[c] += N[j][c] * wk;
+        }
+    }
+}
+
+/*
+ * Forward difference table of a degree p polynomial sampled every h from s=0: the p+1 first values are
+ * computed with Horner's rule and differenced, after that every sample costs p additions.
+ */
+static void DifferenceTable(const double C[], int p, double h, double D[]) {
+    for (int k = 0; k <= p; k++) {
+        double s = k * h, v = 0;
+        for (int c = p; c >= 0; c--) v = v * s + C[c];
+        D[k] = v;
+    }
+    for (int order = 1; order <= p; order++)
+        for (int k = p; k >= order; k--)
+            D[k] -= D[k - 1];
+}
+
+/*
+ * Appends samplesPerSpan points per non empty knot span (and the end point of the curve) to out. The span is
+ * located and turned into polynomials once, then the samples are swept with forward differencing, so the basis
+ * functions are never solved again per sample.
+ */
+void TessellateNurbs(const NurbsCurve& curve, int samplesPerSpan, std::vector<Vector2>& out) {
+    if (!ValidNurbs(curve) || samplesPerSpan < 1) return;
+    int n = (int)curve.P.size(), p = curve.degree;
+    const std::vector<double>& U = curve.knots;
+    for (int i = p; i < n; i++) {
+        if (U[i + 1] <= U[i]) continue;
+        double X[NURBS_MAX_DEGREE + 1], Y[NURBS_MAX_DEGREE + 1], W[NURBS_MAX_DEGREE + 1];
+        SpanPolynomials(curve, i, X, Y, W);
+        double h = (U[i + 1] - U[i]) / samplesPerSpan;
+        double DX[NURBS_MAX_DEGREE + 1], DY[NURBS_MAX_DEGREE + 1], DW[NURBS_MAX_DEGREE + 1];
+        DifferenceTable(X, p, h, DX);
+        DifferenceTable(Y, p, h, DY);
+        DifferenceTable(W, p, h, DW);
+        for (int s = 0; s < samplesPerSpan; s++) {
+            out.push_back(Vector2(DX[0] / DW[0], DY[0] / DW[0]));
+            for (int k = 0; k < p; k++) {
+                DX[k] += DX[k + 1];
+                DY[k] += DY[k + 1];
+                DW[k] += DW[k + 1];
+            }
+        }
+    }
+    out.push_back(EvaluateNurbs(curve, U[n]));
+}
+
+/*
+ * Draws the curve as a connected polyline of samplesPerSpan lines per knot span.
+ */
+void DrawNurbsCurve(HDC hdc, const NurbsCurve& curve, int samplesPerSpan, COLORREF color) {
+    std::vector<Vector2> points;
+    TessellateNurbs(curve, samplesPerSpan, points);
+    DrawPolyline(hdc, points, color);
+}
@@ -0,0 +1,34 @@
+#ifndef PARAMETRICCURVES_NURBS_H
+#define PARAMETRICCURVES_NURBS_H
+
+#include <vector>
+#include "Curves.h"
+
+/*
+ * Highest supported degree, the per span polynomials and difference tables are stack arrays of this size.
+ */
+#define NURBS_MAX_DEGREE 7
+
+/*
+ * B-spline or NURBS curve of the given degree with control points P, one weight per point (an empty weights
+ * vector is a plain B-spline, every weight 1) and P.size()+degree+1 non decreasing knots. The curve is defined
+ * for knots[degree] <= u <= knots[P.size()].
+ */
+struct NurbsCurve {
+    int degree = 3;
+    std::vector<Vector2> P;
+    std::vector<double> weights;
+    std::vector<double> knots;
+};
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+void UniformKnots(NurbsCurve& curve);
+void ClampedKnots(NurbsCurve& curve);
+bool ValidNurbs(const NurbsCurve& curve);
+int FindKnotSpan(const NurbsCurve& curve, double u);
+Vector2 EvaluateNurbs(const NurbsCurve& curve, double u);
+void TessellateNurbs(const NurbsCurve& curve, int samplesPerSpan, std::vector<Vector2>& out);
+void DrawNurbsCurve(HDC hdc, const NurbsCurve& curve, int samplesPerSpan, COLORREF color);
+
+#endif //PARAMETRICCURVES_NURBS_H
@@ -0,0 +1,36 @@
+#ifndef PARAMETRICCURVES_PARALLEL_H
+#define PARAMETRICCURVES_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/*
+ * Runs fn(i) for every i in [0, count) on a pool of workers, each worker takes the next i until none is left.
+ * threads <= 0 means one per hardware thread, it is clamped to [1, count] and the calling thread is one of the
+ * workers. Returns the number of workers used. Same helper as ParallelFor in FillingAndShading/Parallel.h, the
+ * projects are built separately.
+ */
+template<typename F>
+int ParallelFor(int count, int threads, F fn) {
+    if (count <= 0) return 0;
+    if (threads <= 0)
+        threads = (int)std::thread::hardware_concurrency();
+    threads = std::max(1, std::min(threads, count));
+
+    std::atomic<int> next(0);
+    auto worker = [&]() {
+        for (int i = next++; i < count; i = next++)
+            fn(i);
+    };
+    std::vector<std::thread> pool;
+    for (int i = 1; i < threads; i++)
+        pool.emplace_back(worker);
+    worker();
+    for (std::thread& th : pool)
+        th.join();
+    return threads;
+}
+
+#endif //PARAMETRICCURVES_PARALLEL_H
@@ -0,0 +1,96 @@
+#include "TessellationCache.h"
+
+/*
+ * Builds the key of a curve, the kind seeds the hash of the doubles (the same HashDoubles as ArcLengthKeyHash).
+ */
+static TessellationKey MakeKey(CurveKind kind, const Vector2 P[], int n, double extra, double tolerance) {
+    TessellationKey key;
+    key.kind = kind;
+    key.data.reserve(2 * n + 2);
+    for (int i = 0; i < n; i++) {
+        key.data.push_back(P[i].x);
+        key.data.push_back(P[i].y);
+    }
+    key.data.push_back(extra);
+    key.data.push_back(tolerance);
+    key.hash = HashDoubles(key.data.data(), key.data.size(), (unsigned long long)kind);
+    return key;
+}
+
+/*
+ * Returns the polyline of the key, tessellating it with build on a miss. A hit moves the entry to the front
+ * of the list; a miss inserts it there and drops entries from the back while the cache is over budget.
+ */
+template<typename Build>
+static const std::vector<Vector2>& Lookup(TessellationCache& cache, TessellationKey&& key, Build build) {
+    auto found = cache.index.find(key);
+    if (found != cache.index.end()) {
+        cache.hits++;
+        cache.entries.splice(cache.entries.begin(), cache.entries, found->second);
+        return found->second->points;
+    }
+    cache.misses++;
+    cache.entries.push_front(TessellationCache::Entry());
+    TessellationCache::Entry& entry = cache.entries.front();
+    build(entry.points);
+    entry.points.shrink_to_fit();
+    entry.bytes = sizeof(entry) + 2 * key.data.size() * sizeof(double) + entry.points.size() * sizeof(Vector2);
+    entry.key = std::move(key);
+    cache.index.emplace(entry.key, cache.entries.begin());
+    cache.bytes += entry.bytes;
+    while (cache.bytes > cache.budget && cache.entries.size() > 1) {
+        TessellationCache::Entry& last = cache.entries.back();
+        cache.bytes -= last.bytes;
+        cache.index.erase(last.key);
+        cache.entries.pop_back();
+        cache.evictions++;
+    }
+    return entry.points;
+}
+
+const std::vector<Vector2>& TessellationCache::Hermite(Vector2& Point1, Vector2& Tangential_Point1, Vector2& Point2, Vector2& Tangential_Point2, double tolerance) {
+    Vector2 control[4] = {Point1, Tangential_Point1, Point2, Tangential_Point2};
+    return Lookup(*this, MakeKey(CURVE_HERMITE, control, 4, 0, tolerance), [&](std::vector<Vector2>& out) {
+        TessellateHermite(Point1, Tangential_Point1, Point2, Tangential_Point2, tolerance, out);
+    });
+}
+
+const std::vector<Vector2>& TessellationCache::Bezier(Vector2& P0, Vector2& P1, Vector2& P2, Vector2& P3, double tolerance) {
+    Vector2 control[4] = {P0, P1, P2, P3};
+    return Lookup(*this, MakeKey(CURVE_BEZIER, control, 4, 0, tolerance), [&](std::vector<Vector2>& out) {
+        TessellateBezier(P0, P1, P2, P3, tolerance, out);
+    });
+}
+
+const std::vector<Vector2>& TessellationCache::Cardinal(Vector2 P[], int n, double tension, double tolerance) {
+    return Lookup(*this, MakeKey(CURVE_CARDINAL, P, n < 0 ? 0 : n, tension, tolerance), [&](std::vector<Vector2>& out) {
+        TessellateCardinalSpline(P, n, tension, tolerance, out);
+    });
+}
+
+void TessellationCache::Clear() {
+    index.clear();
+    entries.clear();
+    bytes = 0;
+}
+
+/*
+ * Same curve as DrawHermiteCurveAdaptive, the polyline comes from the cache.
+ */
+void DrawHermiteCurve(HDC hdc, TessellationCache& cache, Vector2& Point1, Vector2& Tangential_Point1, Vector2& Point2, Vector2& Tangential_Point2, double tolerance, COLORREF color) {
+    DrawPolyline(hdc, cache.Hermite(Point1, Tangential_Point1, Point2, Tangential_Point2, tolerance), color);
+}
+
+/*
+ * Same curve as DrawBezierCurveAdaptive, the polyline comes from the cache.
+ */
+void DrawBezierCurve(HDC hdc, TessellationCache& cache, Vector2& P0, Vector2& P1, Vector2& P2, Vector2& P3, double tolerance, COLORREF color) {
+    DrawPolyline(hdc, cache.Bezier(P0, P1, P2, P3, tolerance), color);
+}
+
+/*
+ * Same curve as DrawCardinalSplineAdaptive, the polyline of the whole spline is one cache entry.
+ */
+void DrawCardinalSpline(HDC hdc, TessellationCache& cache, Vector2 P[], int n, double tension, double tolerance, COLORREF color) {
+    DrawPolyline(hdc, cache.Cardinal(P, n, tension, tolerance), color);
+}
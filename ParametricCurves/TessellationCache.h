@@ -0,0 +1,71 @@
+#ifndef PARAMETRICCURVES_TESSELLATIONCACHE_H
+#define PARAMETRICCURVES_TESSELLATIONCACHE_H
+
+#include <list>
+#include <unordered_map>
+#include <vector>
+#include "Curves.h"
+
+/*
+ * Default memory budget of a TessellationCache in bytes.
+ */
+#define TESSELLATION_CACHE_BUDGET (16 << 20)
+
+/*
+ * Kind of curve a cached polyline belongs to, part of the key so a Hermite and a Bezier with the same four
+ * points are different entries.
+ */
+enum CurveKind {
+    CURVE_HERMITE,
+    CURVE_BEZIER,
+    CURVE_CARDINAL
+};
+
+/*
+ * Control data of a curve: the kind, the points and tangents (or the spline points followed by the tension)
+ * and the tolerance. The hash is computed once when the key is built.
+ */
+struct TessellationKey {
+    CurveKind kind;
+    std::vector<double> data;
+    size_t hash;
+    bool operator==(const TessellationKey& other) const {
+        return hash == other.hash && kind == other.kind && data == other.data;
+    }
+};
+
+struct TessellationKeyHash {
+    size_t operator()(const TessellationKey& key) const { return key.hash; }
+};
+
+/*
+ * Tessellated polylines of the curves drawn so far keyed by their control data, so a static curve redrawn
+ * every frame is only subdivided the first time. The entries are kept in least recently used order and the
+ * oldest ones are dropped once the keys and points held take more than budget bytes; the entry returned by
+ * Get is never dropped by the same call, so a curve larger than the whole budget is still drawn.
+ */
+struct TessellationCache {
+    struct Entry {
+        TessellationKey key;
+        std::vector<Vector2> points;
+        size_t bytes;
+    };
+    std::list<Entry> entries; // most recently used first
+    std::unordered_map<TessellationKey, std::list<Entry>::iterator, TessellationKeyHash> index;
+    size_t budget, bytes = 0;
+    long long hits = 0, misses = 0, evictions = 0;
+
+    explicit TessellationCache(size_t budget = TESSELLATION_CACHE_BUDGET) : budget(budget) {}
+    const std::vector<Vector2>& Hermite(Vector2& Point1, Vector2& Tangential_Point1, Vector2& Point2, Vector2& Tangential_Point2, double tolerance);
+    const std::vector<Vector2>& Bezier(Vector2& P0, Vector2& P1, Vector2& P2, Vector2& P3, double tolerance);
+    const std::vector<Vector2>& Cardinal(Vector2 P[], int n, double tension, double tolerance);
+    void Clear();
+};
+/*****************************************************************************
+*							Functions Definitions
+******************************************************************************/
+void DrawHermiteCurve(HDC hdc, TessellationCache& cache, Vector2& Point1, Vector2& Tangential_Point1, Vector2& Point2, Vector2& Tangential_Point2, double tolerance, COLORREF color);
+void DrawBezierCurve(HDC hdc, TessellationCache& cache, Vector2& P0, Vector2& P1, Vector2& P2, Vector2& P3, double tolerance, COLORREF color);
+void DrawCardinalSpline(HDC hdc, TessellationCache& cache, Vector2 P[], int n, double tension, double tolerance, COLORREF color);
+
+#endif //PARAMETRICCURVES_TESSELLATIONCACHE_H
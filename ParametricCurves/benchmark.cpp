@@ -0,0 +1,201 @@
+#include <Windows.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
+#include "Curves.h"
+
+/*
+ * Parametric curves benchmark
+ * Description: Compares the Vector4/Matrix4 classes ParametricCurves used before Matrix.h (kept below in the
+ *              legacy namespace, with a counter on the matrix copy constructor) against the Matrix.h
+ *              value types now behind Vector4/Matrix4: number of matrix copies and time per Hermite
+ *              coefficient computation, and time per curve sample of the DrawHermiteCurve loop. The Matrix.h
+ *              copies are counted by running the same products on an element type with a counted copy.
+ * usage: ParametricCurvesBenchmark [curves]   (default 1000000)
+ */
+
+namespace legacy {
+    long long matrixCopies = 0;
+
+    class Vector4 {
+        double v[4];
+    public:
+        Vector4(double a = 0, double b = 0, double c = 0, double d = 0) {
+            v[0] = a; v[1] = b; v[2] = c; v[3] = d;
+        }
+        double& operator[](int i) {
+            return v[i];
+        }
+    };
+
+    class Matrix4 {
+        Vector4 M[4];
+    public:
+        Matrix4(double A[]) {
+            for (int i = 0; i < 4; i++)
+                for (int j = 0; j < 4; j++)
+                    M[i][j] = A[i * 4 + j];
+        }
+        /* same copy as the implicit one, counted */
+        Matrix4(const Matrix4& other) {
+            for (int i = 0; i < 4; i++)
+                M[i] = other.M[i];
+            matrixCopies++;
+        }
+        Vector4& operator[](int i) {
+            return M[i];
+        }
+    };
+
+    Vector4 operator*(Matrix4 M, Vector4& b) {
+        Vector4 res;
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 4; j++)
+                res[i] += M[i][j] * b[j];
+        return res;
+    }
+
+    double DotProduct(Vector4& a, Vector4& b) {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+    }
+
+    Vector4 GetHermiteCoeff(double x1, double u1, double x2, double u2) {
+        static double H[16] = {2, 1, -2, 1, -3, -2, 3, -1, 0, 1, 0, 0, 1, 0, 0, 0};
+        static Matrix4 basis(H);
+        Vector4 v(x1, u1, x2, u2);
+        return basis * v;
+    }
+}
+
+/*
+ * Matrix.h instrumented: a double whose copy constructor is counted. Mat<Counted,4,4> * Vec<Counted,4> runs the
+ * same operator* template as Matrix4 * Vector4, so every matrix or vector element it copies is counted.
+ */
+struct Counted {
+    static long long copies;
+    double value;
+    Counted(double value = 0) : value(value) {}
+    Counted(const Counted& other) : value(other.value) { copies++; }
+    Counted& operator=(const Counted& other) = default;
+};
+long long Counted::copies = 0;
+
+Counted operator*(const Counted& a, const Counted& b) { return Counted(a.value * b.value); }
+Counted operator+(const Counted& a, const Counted& b) { return Counted(a.value + b.value); }
+
+/*
+ * The product Matrix4 * Vector4 must take both operands by const reference, this only compiles if it does.
+ */
+constexpr Vector4 (*MatrixTimesVector)(const Matrix4&, const Vector4&) = operator*;
+static_assert(std::is_same<decltype(&GetHermiteCoeff), Vector4 (*)(double, double, double, double)>::value,
+              "GetHermiteCoeff takes the four scalars and no matrix");
+
+/*
+ * Seconds taken by f()
+ */
+template<typename F>
+double Seconds(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    int curves = argc > 1 ? atoi(argv[1]) : 1000000;
+    if (curves < 1) curves = 1;
+    const int samples = 100;
+    srand(1);
+    std::vector<double> control((size_t)curves * 4);
+    for (double &c : control) c = rand() % 1000;
+
+    /* coefficients: one basis multiplication per curve axis */
+    double sinkOld = 0, sinkNew = 0;
+    legacy::matrixCopies = 0;
+    double coeffOld = Seconds([&]() {
+        for (int i = 0; i < curves; i++) {
+            const double *c = &control[(size_t)i * 4];
+            legacy::Vector4 v = legacy::GetHermiteCoeff(c[0], c[1], c[2], c[3]);
+            sinkOld += v[0] + v[1] + v[2] + v[3];
+        }
+    });
+    long long copiesOld = legacy::matrixCopies;
+    double coeffNew = Seconds([&]() {
+        for (int i = 0; i < curves; i++) {
+            const double *c = &control[(size_t)i * 4];
+            Vector4 v = GetHermiteCoeff(c[0], c[1], c[2], c[3]);
+            sinkNew += v[0] + v[1] + v[2] + v[3];
+        }
+    });
+
+    /* the same products on the instrumented element type, not timed */
+    double H[16];
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            H[i * 4 + j] = HermiteBasis<double>[i][j];
+    Mat<Counted, 4, 4> countedBasis;
+    for (int i = 0; i < 16; i++) countedBasis[i / 4][i % 4] = Counted(H[i]);
+    auto countCopies = [&](int products) {
+        Counted::copies = 0;
+        for (int i = 0; i < products; i++) {
+            const double *c = &control[(size_t)(i % curves) * 4];
+            Vec<Counted, 4> v = countedBasis * Vec<Counted, 4>(c[0], c[1], c[2], c[3]);
+            (void)v;
+        }
+        return Counted::copies;
+    };
+    long long elementCopies = countCopies(curves);
+
+    printf("Hermite coefficients, %d curves\n", curves);
+    printf("%10s %16s %16s %12s\n", "", "matrix copies", "bytes copied", "ns/curve");
+    printf("%10s %16lld %16lld %12.2f\n", "legacy", copiesOld, copiesOld * (long long)sizeof(legacy::Matrix4), coeffOld * 1e9 / curves);
+    printf("%10s %16lld %16lld %12.2f\n", "Matrix.h", elementCopies / 16, elementCopies * (long long)sizeof(double), coeffNew * 1e9 / curves);
+    printf("Matrix.h operator* takes (const Matrix4&, const Vector4&): %s\n", "yes (checked at compile time)");
+
+    /* the DrawHermiteCurve sample loop: powers of t and two dot products per sample */
+    int sampleCurves = curves / 10 > 0 ? curves / 10 : 1;
+    double dt = 1.0 / (samples - 1);
+    legacy::matrixCopies = 0;
+    double loopOld = Seconds([&]() {
+        for (int i = 0; i < sampleCurves; i++) {
+            const double *c = &control[(size_t)i * 4];
+            legacy::Vector4 X = legacy::GetHermiteCoeff(c[0], c[1], c[2], c[3]);
+            legacy::Vector4 Y = legacy::GetHermiteCoeff(c[3], c[2], c[1], c[0]);
+            for (int s = 0; s < samples; s++) {
+                double t = s * dt;
+                legacy::Vector4 vt;
+                vt[3] = 1;
+                for (int k = 2; k >= 0; k--) vt[k] = vt[k + 1] * t;
+                sinkOld += Round(legacy::DotProduct(X, vt)) + Round(legacy::DotProduct(Y, vt));
+            }
+        }
+    });
+    copiesOld = legacy::matrixCopies;
+    double loopNew = Seconds([&]() {
+        for (int i = 0; i < sampleCurves; i++) {
+            const double *c = &control[(size_t)i * 4];
+            Vector4 X = GetHermiteCoeff(c[0], c[1], c[2], c[3]);
+            Vector4 Y = GetHermiteCoeff(c[3], c[2], c[1], c[0]);
+            for (int s = 0; s < samples; s++) {
+                double t = s * dt;
+                Vector4 vt;
+                vt[3] = 1;
+                for (int k = 2; k >= 0; k--) vt[k] = vt[k + 1] * t;
+                sinkNew += Round(DotProduct(X, vt)) + Round(DotProduct(Y, vt));
+            }
+        }
+    });
+
+    elementCopies = countCopies(2 * sampleCurves);
+
+    printf("\nDrawHermiteCurve sample loop, %d curves x %d samples\n", sampleCurves, samples);
+    printf("%10s %16s %12s\n", "", "matrix copies", "ns/sample");
+    printf("%10s %16lld %12.2f\n", "legacy", copiesOld, loopOld * 1e9 / ((double)sampleCurves * samples));
+    printf("%10s %16lld %12.2f\n", "Matrix.h", elementCopies / 16, loopNew * 1e9 / ((double)sampleCurves * samples));
+
+    /* both versions must compute the same values */
+    printf("\nchecksum %s\n", sinkOld == sinkNew ? "equal" : "DIFFERENT");
+    return sinkOld == sinkNew ? 0 : 1;
+}